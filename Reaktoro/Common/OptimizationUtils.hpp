@@ -21,6 +21,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
 
 namespace Reaktoro {
@@ -29,12 +30,20 @@ template <typename Ret, typename... Args>
 auto memoize(std::function<Ret(Args...)> f) -> std::function<Ret(Args...)>
 {
     auto cache = std::make_shared<std::map<std::tuple<Args...>, Ret>>();
+    auto mutex = std::make_shared<std::mutex>();
     return [=](Args... args) mutable -> Ret
     {
+        // The cache is shared among all copies of this function, which can be called concurrently
         std::tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        {
+            std::lock_guard<std::mutex> lock(*mutex);
+            auto it = cache->find(t);
+            if(it != cache->end())
+                return it->second;
+        }
+        Ret res = f(args...);
+        std::lock_guard<std::mutex> lock(*mutex);
+        return cache->emplace(t, res).first->second;
     };
 }
 
@@ -0,0 +1,174 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ThreadPool.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Reaktoro {
+
+struct ThreadPool::Impl
+{
+    /// The threads of the pool, other than the calling one
+    std::vector<std::thread> threads;
+
+    /// The mutex and condition variables used to start a loop and wait for its completion
+    std::mutex mutex;
+    std::condition_variable started, finished;
+
+    /// The mutex that ensures loops from different calling threads are not mixed
+    std::mutex loop_mutex;
+
+    /// The function, number of indices and chunk size of the current loop
+    const std::function<void(Index, Index)>* task = nullptr;
+    Index size = 0, chunk = 0;
+
+    /// The number of loops started so far, used by the threads to detect a new one
+    unsigned long generation = 0;
+
+    /// The number of threads of the pool that have not finished the current loop
+    Index pending = 0;
+
+    /// The boolean flag that indicates the threads should terminate
+    bool stop = false;
+
+    /// The first exception thrown in the current loop
+    std::exception_ptr error;
+
+    Impl(unsigned num_threads)
+    {
+        if(num_threads == 0)
+            num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        threads.reserve(num_threads - 1);
+        for(Index thread = 1; thread < num_threads; ++thread)
+            threads.emplace_back([=]() { work(thread); });
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        started.notify_all();
+        for(auto& thread : threads)
+            thread.join();
+    }
+
+    /// Execute the chunk of indices of the current loop assigned to a thread, keeping any exception thrown.
+    auto run(Index thread) -> void
+    {
+        const Index begin = thread * chunk;
+        const Index end = std::min(size, begin + chunk);
+        try {
+            for(Index i = begin; i < end; ++i)
+                (*task)(i, thread);
+        }
+        catch(...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!error) error = std::current_exception();
+        }
+    }
+
+    /// The loop executed by each thread of the pool, waiting for new loops until the pool is destroyed.
+    auto work(Index thread) -> void
+    {
+        unsigned long seen = 0;
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                started.wait(lock, [&]() { return stop || generation != seen; });
+                if(stop) return;
+                seen = generation;
+            }
+
+            run(thread);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if(--pending == 0)
+                finished.notify_one();
+        }
+    }
+
+    auto parallelFor(Index size_, const std::function<void(Index, Index)>& f, Index grain) -> void
+    {
+        std::lock_guard<std::mutex> loop_lock(loop_mutex);
+
+        const Index num_threads = threads.size() + 1;
+        const Index nthreads = std::max<Index>(std::min<Index>(num_threads, (size_ + grain - 1)/std::max<Index>(grain, 1)), 1);
+
+        // Execute the loop in the calling thread only if it is not worth waking up the others
+        if(nthreads == 1)
+        {
+            for(Index i = 0; i < size_; ++i)
+                f(i, 0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = &f;
+            size = size_;
+            chunk = (size_ + nthreads - 1)/nthreads;
+            pending = threads.size();
+            error = nullptr;
+            ++generation;
+        }
+
+        started.notify_all();
+
+        run(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&]() { return pending == 0; });
+        task = nullptr;
+
+        if(error)
+            std::rethrow_exception(error);
+    }
+};
+
+ThreadPool::ThreadPool()
+: ThreadPool(0)
+{}
+
+ThreadPool::ThreadPool(unsigned num_threads)
+: pimpl(new Impl(num_threads))
+{}
+
+ThreadPool::~ThreadPool()
+{}
+
+auto ThreadPool::numThreads() const -> unsigned
+{
+    return pimpl->threads.size() + 1;
+}
+
+auto ThreadPool::parallelFor(Index size, const std::function<void(Index, Index)>& f, Index grain) -> void
+{
+    pimpl->parallelFor(size, f, grain);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,64 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <memory>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
+namespace Reaktoro {
+
+/// A class that keeps a set of threads alive to execute parallel loops.
+/// The threads are created once, in the construction of the pool, and wait between
+/// parallel loops, which avoids creating threads in every loop of an iterative method.
+/// The calling thread participates in every loop. Loops started concurrently from
+/// different threads on the same pool are executed one after the other.
+class ThreadPool
+{
+public:
+    /// Construct a ThreadPool instance using the number of concurrent threads supported by the hardware.
+    ThreadPool();
+
+    /// Construct a ThreadPool instance with given number of threads, including the calling one.
+    /// @param num_threads The number of threads (zero for the number supported by the hardware)
+    explicit ThreadPool(unsigned num_threads);
+
+    /// Destroy this ThreadPool instance, joining all its threads.
+    ~ThreadPool();
+
+    /// Return the number of threads in the pool, including the calling one.
+    auto numThreads() const -> unsigned;
+
+    /// Apply a function `f(index, thread)` to every index in `[0, size)`, split in contiguous chunks among the threads.
+    /// The index of the thread, in `[0, numThreads())`, can be used to access thread-local work memory.
+    /// An exception thrown by the function in any thread is rethrown in the calling thread.
+    /// @param size The number of indices
+    /// @param f The function applied to every index
+    /// @param grain The minimum number of indices assigned to a thread
+    auto parallelFor(Index size, const std::function<void(Index, Index)>& f, Index grain = 1) -> void;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
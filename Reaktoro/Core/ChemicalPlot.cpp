@@ -18,6 +18,7 @@
 #include "ChemicalPlot.hpp"
 
 // C++ includes
+#include <atomic>
 #include <cstdio>
 #include <fstream>
 #include <iomanip>
@@ -155,8 +156,8 @@ struct ChemicalPlot::Impl
     /// The iteration number for every update call
     Index iteration = 0;
 
-    /// The counter of ChemicalPlot instances
-    static unsigned counter;
+    /// The counter of ChemicalPlot instances (atomic, since instances can be created in different threads)
+    static std::atomic<unsigned> counter;
 
     /// The ID of this ChemicalPlot instance (by order of creation)
     unsigned id;
@@ -329,7 +330,7 @@ struct ChemicalPlot::Impl
 };
 
 // Initialize the counter of ChemicalPlot instances
-unsigned ChemicalPlot::Impl::counter = 0;
+std::atomic<unsigned> ChemicalPlot::Impl::counter(0);
 
 ChemicalPlot::ChemicalPlot()
 : pimpl(new Impl())
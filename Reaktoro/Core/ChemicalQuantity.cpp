@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <map>
+#include <unordered_map>
 
 // Reaktoro includes
 #include <Reaktoro/Common/ConvertUtils.hpp>
@@ -175,7 +176,7 @@ struct ChemicalQuantity::Impl
     ChemicalVector rates;
 
     /// All created chemical quantity functions from formatted strings
-    std::map<std::string, Function> function_map;
+    std::unordered_map<std::string, Function> function_map;
 
     /// Construct a default Impl instance
     Impl()
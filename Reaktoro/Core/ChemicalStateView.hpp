@@ -0,0 +1,95 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// A lightweight view of a chemical state whose data is stored elsewhere.
+/// A ChemicalStateView refers to the temperature, pressure, molar amounts of the species, and dual
+/// potentials of the elements and species of a chemical state stored in external memory, such as a
+/// row of the contiguous arrays of a field of chemical states. It can be given to EquilibriumSolver
+/// in place of a ChemicalState so that the external memory is updated without any copy.
+/// @see ChemicalState, EquilibriumSolver
+class ChemicalStateView
+{
+public:
+    /// Construct a ChemicalStateView instance.
+    /// @param T The temperature of the chemical state (in units of K)
+    /// @param P The pressure of the chemical state (in units of Pa)
+    /// @param n The molar amounts of the species (in units of mol)
+    /// @param y The dual potentials of the elements (in units of J/mol)
+    /// @param z The dual potentials of the species (in units of J/mol)
+    ChemicalStateView(double& T, double& P, VectorRef n, VectorRef y, VectorRef z)
+    : m_T(T), m_P(P), m_n(n), m_y(y), m_z(z)
+    {}
+
+    /// Set the temperature of the chemical state (in units of K)
+    auto setTemperature(double val) -> void { m_T = val; }
+
+    /// Set the pressure of the chemical state (in units of Pa)
+    auto setPressure(double val) -> void { m_P = val; }
+
+    /// Set the molar amounts of the species (in units of mol)
+    auto setSpeciesAmounts(VectorConstRef n) -> void { m_n = n; }
+
+    /// Set the dual potentials of the elements (in units of J/mol)
+    auto setElementDualPotentials(VectorConstRef y) -> void { m_y = y; }
+
+    /// Set the dual potentials of the species (in units of J/mol)
+    auto setSpeciesDualPotentials(VectorConstRef z) -> void { m_z = z; }
+
+    /// Return the temperature of the chemical state (in units of K)
+    auto temperature() const -> double { return m_T; }
+
+    /// Return the pressure of the chemical state (in units of Pa)
+    auto pressure() const -> double { return m_P; }
+
+    /// Return the molar amounts of the species (in units of mol)
+    auto speciesAmounts() const -> VectorConstRef { return m_n; }
+
+    /// Return the molar amount of a species (in units of mol)
+    auto speciesAmount(Index index) const -> double { return m_n[index]; }
+
+    /// Return the dual potentials of the elements (in units of J/mol)
+    auto elementDualPotentials() const -> VectorConstRef { return m_y; }
+
+    /// Return the dual potentials of the species (in units of J/mol)
+    auto speciesDualPotentials() const -> VectorConstRef { return m_z; }
+
+private:
+    /// The temperature of the chemical state (in units of K)
+    double& m_T;
+
+    /// The pressure of the chemical state (in units of Pa)
+    double& m_P;
+
+    /// The molar amounts of the species (in units of mol)
+    VectorRef m_n;
+
+    /// The dual potentials of the elements (in units of J/mol)
+    VectorRef m_y;
+
+    /// The dual potentials of the species (in units of J/mol)
+    VectorRef m_z;
+};
+
+} // namespace Reaktoro
@@ -18,15 +18,19 @@
 #include "ChemicalSystem.hpp"
 
 // C++ includes
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Core/Connectivity.hpp>
 #include <Reaktoro/Core/ThermoProperties.hpp>
 #include <Reaktoro/Core/Utils.hpp>
 
@@ -72,6 +76,25 @@ auto collectSpecies(const std::vector<Phase>& phases) -> std::vector<Species>
     return list;
 }
 
+/// Return a hash table mapping the names of the given entities to their indices.
+/// The first entity with a given name is kept, consistent with the linear search in `index`.
+template<typename EntityType>
+auto hashIndices(const std::vector<EntityType>& entities) -> std::unordered_map<std::string, Index>
+{
+    std::unordered_map<std::string, Index> indices;
+    indices.reserve(entities.size());
+    for(Index i = 0; i < entities.size(); ++i)
+        indices.emplace(entities[i].name(), i);
+    return indices;
+}
+
+/// Return the index of an entity name in a hash table, or the number of entities if not found.
+auto hashIndex(const std::string& name, const std::unordered_map<std::string, Index>& indices, Index size) -> Index
+{
+    const auto it = indices.find(name);
+    return it != indices.end() ? it->second : size;
+}
+
 } // namespace
 
 struct ChemicalSystem::Impl
@@ -91,26 +114,47 @@ struct ChemicalSystem::Impl
     /// The chemical model of the system
     ChemicalModel chemical_model;
 
-    /// The formula matrix of the system
+    /// The hash tables mapping the names of the phases, species and elements to their indices
+    std::unordered_map<std::string, Index> phase_indices, species_indices, element_indices;
+
+    /// The index of the first species of each phase, followed by the number of species in the system
+    Indices phase_offsets = Indices(1, 0);
+
+    /// The formula matrix of the system, computed on first use
     Matrix formula_matrix;
 
+    /// The connectivity of the elements, species and phases of the system, computed on first use
+    Connectivity connectivity;
+
+    /// The indices of the fluid and solid phases and of their species, computed on first use
+    Indices fluid_phases, fluid_species, solid_phases, solid_species;
+
+    /// The flags that ensure the data computed on first use are computed once, even when requested concurrently
+    std::once_flag formula_matrix_flag, connectivity_flag, fluid_solid_flag;
+
+    /// The boolean flag that indicates if the models were given instead of assembled from the phases
+    bool custom_models = false;
+
+    /// The boolean flag that indicates if the given models can be evaluated concurrently
+    bool concurrent_models = false;
+
     Impl()
     {}
 
     Impl(const std::vector<Phase>& phaselist)
     {
         initializePhasesSpeciesElements(phaselist);
-        initializeFormulaMatrix();
         initializeThermoModel();
         initializeChemicalModel();
     }
 
-    Impl(const std::vector<Phase>& phaselist, const ThermoModel& tm, const ChemicalModel& cm)
+    Impl(const std::vector<Phase>& phaselist, const ThermoModel& tm, const ChemicalModel& cm, bool concurrent)
     {
         initializePhasesSpeciesElements(phaselist);
-        initializeFormulaMatrix();
         thermo_model = tm;
         chemical_model = cm;
+        custom_models = true;
+        concurrent_models = concurrent;
     }
 
     auto initializePhasesSpeciesElements(const std::vector<Phase>& phaselist) -> void
@@ -118,16 +162,36 @@ struct ChemicalSystem::Impl
         phases = fixDuplicatedSpeciesNames(phaselist);
         species = collectSpecies(phases);
         elements = collectElements(species);
+        phase_indices = hashIndices(phases);
+        species_indices = hashIndices(species);
+        element_indices = hashIndices(elements);
+
+        phase_offsets.assign(1, 0);
+        for(const Phase& phase : phases)
+            phase_offsets.push_back(phase_offsets.back() + phase.numSpecies());
     }
 
     auto initializeFormulaMatrix() -> void
     {
-        const auto num_elements = elements.size();
-        const auto num_species = species.size();
-        formula_matrix.resize(num_elements, num_species);
-        for(unsigned i = 0; i < num_species; ++i)
-            for(unsigned j = 0; j < num_elements; ++j)
-                formula_matrix(j, i) = species[i].elementCoefficient(elements[j].name());
+        formula_matrix = zeros(elements.size(), species.size());
+        for(Index i = 0; i < species.size(); ++i)
+            for(const auto& pair : species[i].elements())
+                formula_matrix(hashIndex(pair.first.name(), element_indices, elements.size()), i) = pair.second;
+    }
+
+    auto initializeFluidSolidIndices() -> void
+    {
+        for(Index i = 0; i < phases.size(); ++i)
+        {
+            if(phases[i].isFluid()) fluid_phases.push_back(i);
+            if(phases[i].isSolid()) solid_phases.push_back(i);
+        }
+        for(Index i : fluid_phases)
+            for(Index j = phase_offsets[i]; j < phase_offsets[i + 1]; ++j)
+                fluid_species.push_back(j);
+        for(Index i : solid_phases)
+            for(Index j = phase_offsets[i]; j < phase_offsets[i + 1]; ++j)
+                solid_species.push_back(j);
     }
 
     auto initializeThermoModel() -> void
@@ -173,7 +237,11 @@ ChemicalSystem::ChemicalSystem(const std::vector<Phase>& phases)
 {}
 
 ChemicalSystem::ChemicalSystem(const std::vector<Phase>& phases, const ThermoModel& thermo_model, const ChemicalModel& chemical_model)
-: pimpl(new Impl(phases, thermo_model, chemical_model))
+: pimpl(new Impl(phases, thermo_model, chemical_model, false))
+{}
+
+ChemicalSystem::ChemicalSystem(const std::vector<Phase>& phases, const ThermoModel& thermo_model, const ChemicalModel& chemical_model, bool concurrent)
+: pimpl(new Impl(phases, thermo_model, chemical_model, concurrent))
 {}
 
 ChemicalSystem::~ChemicalSystem()
@@ -259,12 +327,19 @@ auto ChemicalSystem::chemicalModel() const -> const ChemicalModel&
 
 auto ChemicalSystem::formulaMatrix() const -> MatrixConstRef
 {
+    std::call_once(pimpl->formula_matrix_flag, [&] { pimpl->initializeFormulaMatrix(); });
     return pimpl->formula_matrix;
 }
 
+auto ChemicalSystem::connectivity() const -> const Connectivity&
+{
+    std::call_once(pimpl->connectivity_flag, [&] { pimpl->connectivity = Connectivity(*this); });
+    return pimpl->connectivity;
+}
+
 auto ChemicalSystem::indexElement(std::string name) const -> Index
 {
-    return index(name, elements());
+    return hashIndex(name, pimpl->element_indices, numElements());
 }
 
 auto ChemicalSystem::indexElementWithError(std::string name) const -> Index
@@ -280,7 +355,7 @@ auto ChemicalSystem::indexElementWithError(std::string name) const -> Index
 
 auto ChemicalSystem::indexSpecies(std::string name) const -> Index
 {
-    return index(name, species());
+    return hashIndex(name, pimpl->species_indices, numSpecies());
 }
 
 auto ChemicalSystem::indexSpeciesWithError(std::string name) const -> Index
@@ -294,7 +369,13 @@ auto ChemicalSystem::indexSpeciesWithError(std::string name) const -> Index
 
 auto ChemicalSystem::indexSpeciesAny(const std::vector<std::string>& names) const -> Index
 {
-    return indexAny(names, species());
+    for(const std::string& name : names)
+    {
+        const Index index = indexSpecies(name);
+        if(index < numSpecies())
+            return index;
+    }
+    return numSpecies();
 }
 
 auto ChemicalSystem::indexSpeciesAnyWithError(const std::vector<std::string>& names) const -> Index
@@ -309,7 +390,7 @@ auto ChemicalSystem::indexSpeciesAnyWithError(const std::vector<std::string>& na
 
 auto ChemicalSystem::indexPhase(std::string name) const -> Index
 {
-    return index(name, phases());
+    return hashIndex(name, pimpl->phase_indices, numPhases());
 }
 
 auto ChemicalSystem::indexPhaseWithError(std::string name) const -> Index
@@ -325,21 +406,16 @@ auto ChemicalSystem::indexPhaseWithError(std::string name) const -> Index
 
 auto ChemicalSystem::indexPhaseWithSpecies(Index index) const -> Index
 {
-    unsigned counter = 0;
-    for(unsigned i = 0; i < numPhases(); ++i)
-    {
-        counter += numSpeciesInPhase(i);
-        if(counter > index) return i;
-    }
-    return numPhases();
+    const auto& offsets = pimpl->phase_offsets;
+    return std::upper_bound(offsets.begin(), offsets.end(), index) - offsets.begin() - 1;
 }
 
 auto ChemicalSystem::indexFirstSpeciesInPhase(Index iphase) const -> unsigned
 {
-    unsigned counter = 0;
-    for(unsigned i = 0; i < iphase; ++i)
-        counter += phase(i).species().size();
-    return counter;
+    Assert(iphase <= numPhases(),
+        "Could not get the index of the first species in a phase with given index.",
+        "The given index " + std::to_string(iphase) + " is out of bounds.")
+    return pimpl->phase_offsets[iphase];
 }
 
 auto ChemicalSystem::indicesElements(const std::vector<std::string>& names) const -> Indices
@@ -353,21 +429,20 @@ auto ChemicalSystem::indicesElements(const std::vector<std::string>& names) cons
 
 auto ChemicalSystem::indicesElementsInSpecies(Index index) const -> Indices
 {
-    Indices indices;
-    for(const auto& pair : species(index).elements())
-        indices.push_back(indexElement(pair.first.name()));
-    return indices;
+    return connectivity().indicesElementsInSpecies(index);
 }
 
 auto ChemicalSystem::indicesElementsInSpecies(const Indices& ispecies) const -> Indices
 {
-    std::set<Index> ielements;
-    for(const Index& i : ispecies)
-    {
-        const Indices& indices = indicesElementsInSpecies(i);
-        ielements.insert(indices.begin(), indices.end());
-    }
-    return Indices(ielements.begin(), ielements.end());
+    std::vector<bool> contained(numElements(), false);
+    for(Index i : ispecies)
+        for(Index j : connectivity().indicesElementsInSpecies(i))
+            contained[j] = true;
+
+    Indices ielements;
+    for(Index j = 0; j < contained.size(); ++j)
+        if(contained[j]) ielements.push_back(j);
+    return ielements;
 }
 
 auto ChemicalSystem::indicesSpecies(const std::vector<std::string>& names) const -> Indices
@@ -411,34 +486,28 @@ auto ChemicalSystem::indicesPhasesWithSpecies(const Indices& ispecies) const ->
     return iphases;
 }
 
-auto ChemicalSystem::indicesFluidPhases() const -> Indices
+auto ChemicalSystem::indicesFluidPhases() const -> const Indices&
 {
-    Indices indices;
-    indices.reserve(numPhases());
-    for(Index i = 0; i < numPhases(); ++i)
-        if(phase(i).isFluid())
-            indices.push_back(i);
-    return indices;
+    std::call_once(pimpl->fluid_solid_flag, [&] { pimpl->initializeFluidSolidIndices(); });
+    return pimpl->fluid_phases;
 }
 
-auto ChemicalSystem::indicesFluidSpecies() const -> Indices
+auto ChemicalSystem::indicesFluidSpecies() const -> const Indices&
 {
-    return indicesSpeciesInPhases(indicesFluidPhases());
+    std::call_once(pimpl->fluid_solid_flag, [&] { pimpl->initializeFluidSolidIndices(); });
+    return pimpl->fluid_species;
 }
 
-auto ChemicalSystem::indicesSolidPhases() const -> Indices
+auto ChemicalSystem::indicesSolidPhases() const -> const Indices&
 {
-    Indices indices;
-    indices.reserve(numPhases());
-    for(Index i = 0; i < numPhases(); ++i)
-        if(phase(i).isSolid())
-            indices.push_back(i);
-    return indices;
+    std::call_once(pimpl->fluid_solid_flag, [&] { pimpl->initializeFluidSolidIndices(); });
+    return pimpl->solid_phases;
 }
 
-auto ChemicalSystem::indicesSolidSpecies() const -> Indices
+auto ChemicalSystem::indicesSolidSpecies() const -> const Indices&
 {
-    return indicesSpeciesInPhases(indicesSolidPhases());
+    std::call_once(pimpl->fluid_solid_flag, [&] { pimpl->initializeFluidSolidIndices(); });
+    return pimpl->solid_species;
 }
 
 auto ChemicalSystem::elementAmounts(VectorConstRef n) const -> Vector
@@ -505,6 +574,29 @@ auto ChemicalSystem::properties(double T, double P, VectorConstRef n) const -> C
     return prop;
 }
 
+auto ChemicalSystem::cloneable() const -> bool
+{
+    return !pimpl->custom_models || pimpl->concurrent_models;
+}
+
+auto ChemicalSystem::clone() const -> ChemicalSystem
+{
+    Assert(cloneable(), "Could not clone the chemical system.",
+        "Its thermodynamic and chemical models were given as functions whose "
+        "captured state cannot be copied nor evaluated concurrently.");
+
+    // The given models can be evaluated concurrently, so the copy can share them
+    if(pimpl->custom_models)
+        return *this;
+
+    std::vector<Phase> phases;
+    phases.reserve(numPhases());
+    for(const Phase& phase : pimpl->phases)
+        phases.push_back(phase.clone());
+
+    return ChemicalSystem(phases);
+}
+
 auto operator<<(std::ostream& out, const ChemicalSystem& system) -> std::ostream&
 {
     const auto& phases = system.phases();
@@ -29,9 +29,13 @@ namespace Reaktoro {
 
 // Forward declarations
 class ChemicalProperties;
+class Connectivity;
 class ThermoProperties;
 
 /// A class to represent a system and its attributes and properties.
+/// A ChemicalSystem instance is an immutable, reference-counted handle: its copies share the same
+/// phases, species, elements and models, as well as the data derived from them (e.g., the formula
+/// matrix and the connectivity), which are computed on first use.
 /// @see Species, Phase
 /// @ingroup Core
 class ChemicalSystem
@@ -46,6 +50,10 @@ public:
     /// Construct a ChemicalSystem instance with given phases and thermodynamic and chemical models.
     ChemicalSystem(const std::vector<Phase>& phases, const ThermoModel& thermo_model, const ChemicalModel& chemical_model);
 
+    /// Construct a ChemicalSystem instance with given phases and thermodynamic and chemical models.
+    /// @param concurrent The boolean flag that indicates if the given models can be evaluated concurrently
+    ChemicalSystem(const std::vector<Phase>& phases, const ThermoModel& thermo_model, const ChemicalModel& chemical_model, bool concurrent);
+
     /// Destroy this ChemicalSystem instance
     virtual ~ChemicalSystem();
 
@@ -82,6 +90,9 @@ public:
     /// is given by the number of atoms of its `j`-th element in its `i`-th species.
     auto formulaMatrix() const -> MatrixConstRef;
 
+    /// Return the connectivity of the elements, species, and phases in the system
+    auto connectivity() const -> const Connectivity&;
+
     /// Return an element of the system
     /// @param index The index of the element
     auto element(Index index) const -> const Element&;
@@ -180,16 +191,16 @@ public:
     auto indicesPhasesWithSpecies(const Indices& indices) const -> Indices;
 
     /// Return the indices of the fluid phases.
-    auto indicesFluidPhases() const -> Indices;
+    auto indicesFluidPhases() const -> const Indices&;
 
     /// Return the indices of the species in the fluid phases.
-    auto indicesFluidSpecies() const -> Indices;
+    auto indicesFluidSpecies() const -> const Indices&;
 
     /// Return the indices of the solid phases.
-    auto indicesSolidPhases() const -> Indices;
+    auto indicesSolidPhases() const -> const Indices&;
 
     /// Return the indices of the species in the solid phases.
-    auto indicesSolidSpecies() const -> Indices;
+    auto indicesSolidSpecies() const -> const Indices&;
 
     /// Calculate the molar amounts of the elements (in units of mol)
     /// @param n The molar amounts of the species (in units of mol)
@@ -233,6 +244,23 @@ public:
     /// @param n The molar amounts of the species (in units of mol)
     auto properties(double T, double P, VectorConstRef n) const -> ChemicalProperties;
 
+    /// Return true if this ChemicalSystem instance can be cloned with method @ref clone.
+    /// This is false for a chemical system constructed with given thermodynamic and chemical
+    /// model functions, unless these were declared as concurrent, since the state captured
+    /// by these functions cannot be copied. The chemical systems created from Phreeqc and
+    /// Gems instances are cloneable, since their models use a different backend instance
+    /// in each thread.
+    auto cloneable() const -> bool;
+
+    /// Return a deep copy of this ChemicalSystem instance.
+    /// Copies of a ChemicalSystem instance share the same thermodynamic and chemical models,
+    /// which keep internal work memory and thus cannot be evaluated concurrently.
+    /// The returned system has its own copy of these models (and of the models of its phases)
+    /// and can be used in a different thread than this one. For a chemical system with
+    /// concurrent thermodynamic and chemical models, the returned system shares these models.
+    /// An exception is thrown if this chemical system is not cloneable (see @ref cloneable).
+    auto clone() const -> ChemicalSystem;
+
 private:
     struct Impl;
 
@@ -17,8 +17,10 @@
 
 #include "Connectivity.hpp"
 
+// C++ includes
+#include <algorithm>
+
 // Reaktoro includes
-#include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 
 namespace Reaktoro {
@@ -48,39 +50,49 @@ struct Connectivity::Impl
 
     Impl(const ChemicalSystem& system)
     {
-        const auto& elements = system.elements();
         const auto& species = system.species();
         const auto& phases = system.phases();
 
-        const unsigned num_elements = elements.size();
+        const unsigned num_elements = system.numElements();
         const unsigned num_species = species.size();
         const unsigned num_phases = phases.size();
 
+        // The elements of each species in ascending order of their indices, as well as the species of each element
         element_to_species.resize(num_elements);
         species_to_elements.resize(num_species);
-        for(unsigned j = 0; j < num_elements; ++j)
-            for(unsigned i = 0; i < num_species; ++i)
-                if(species[i].elements().count(elements[j])) {
-                    element_to_species[j].push_back(i);
-                    species_to_elements[i].push_back(j); }
-
+        for(unsigned i = 0; i < num_species; ++i)
+        {
+            for(const auto& pair : species[i].elements())
+                species_to_elements[i].push_back(system.indexElement(pair.first.name()));
+            std::sort(species_to_elements[i].begin(), species_to_elements[i].end());
+            for(Index j : species_to_elements[i])
+                element_to_species[j].push_back(i);
+        }
+
+        // The species of each phase are stored contiguously in the system
         species_to_phase.resize(num_species);
         phase_to_species.resize(num_phases);
         for(unsigned k = 0; k < num_phases; ++k)
-            for(unsigned i = 0; i < num_species; ++i)
-                if(contained(species[i], phases[k].species())) {
-                    species_to_phase[i] = k;
-                    phase_to_species[k].push_back(i);
-                }
+        {
+            const Index ifirst = system.indexFirstSpeciesInPhase(k);
+            for(unsigned i = ifirst; i < ifirst + phases[k].numSpecies(); ++i)
+            {
+                species_to_phase[i] = k;
+                phase_to_species[k].push_back(i);
+            }
+        }
 
         element_to_phases.resize(num_elements);
         phase_to_elements.resize(num_phases);
         for(unsigned k = 0; k < num_phases; ++k)
-            for(unsigned j = 0; j < num_elements; ++j)
-                if(contained(elements[j], phases[k].elements())) {
-                    element_to_phases[j].push_back(k);
-                    phase_to_elements[k].push_back(j);
-                }
+        {
+            for(const Element& element : phases[k].elements())
+                if(system.indexElement(element.name()) < num_elements)
+                    phase_to_elements[k].push_back(system.indexElement(element.name()));
+            std::sort(phase_to_elements[k].begin(), phase_to_elements[k].end());
+            for(Index j : phase_to_elements[k])
+                element_to_phases[j].push_back(k);
+        }
     }
 };
 
@@ -93,7 +105,7 @@ Connectivity::Connectivity(const ChemicalSystem& system)
 {}
 
 Connectivity::Connectivity(const Connectivity& other)
-: pimpl(new Impl(*other.pimpl))
+: pimpl(other.pimpl)
 {}
 
 Connectivity::~Connectivity()
@@ -29,7 +29,8 @@ namespace Reaktoro {
 // Forward declarations
 class ChemicalSystem;
 
-/// A type to describe the connectivity of elements, species, and phases in a chemical system
+/// A type to describe the connectivity of elements, species, and phases in a chemical system.
+/// A Connectivity instance is immutable, so that its copies share the same data.
 /// @see ChemicalSystem, Element, Species, Phase
 /// @ingroup Core
 class Connectivity
@@ -77,7 +78,7 @@ public:
 private:
     struct Impl;
 
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<const Impl> pimpl;
 };
 
 } // namespace Reaktoro
@@ -17,6 +17,9 @@
 
 #include "Partition.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
@@ -159,6 +162,12 @@ struct Partition::Impl
     /// The formula matrix of the inert-solid partition
     Matrix formula_matrix_inert_solid;
 
+    /// The boolean flag that indicates if the formula matrices are consistent with the current partition
+    bool formula_matrices_updated = false;
+
+    /// The mutex that protects the formula matrices, which are computed on first use after the partition changes
+    std::mutex formula_matrices_mutex;
+
 
     Impl()
     {}
@@ -240,6 +249,17 @@ struct Partition::Impl
         indices_inert_fluid_elements = system.indicesElementsInSpecies(indices_inert_fluid_species);
         indices_inert_solid_elements = system.indicesElementsInSpecies(indices_inert_solid_species);
 
+        std::lock_guard<std::mutex> lock(formula_matrices_mutex);
+        formula_matrices_updated = false;
+    }
+
+    auto updateFormulaMatrices() -> void
+    {
+        std::lock_guard<std::mutex> lock(formula_matrices_mutex);
+
+        if(formula_matrices_updated)
+            return;
+
         formula_matrix_equilibrium       = submatrix(system.formulaMatrix(), indices_equilibrium_elements, indices_equilibrium_species);
         formula_matrix_equilibrium_fluid = submatrix(system.formulaMatrix(), indices_equilibrium_fluid_elements, indices_equilibrium_fluid_species);
         formula_matrix_equilibrium_solid = submatrix(system.formulaMatrix(), indices_equilibrium_solid_elements, indices_equilibrium_solid_species);
@@ -251,6 +271,8 @@ struct Partition::Impl
         formula_matrix_inert       = submatrix(system.formulaMatrix(), indices_inert_elements, indices_inert_species);
         formula_matrix_inert_fluid = submatrix(system.formulaMatrix(), indices_inert_fluid_elements, indices_inert_fluid_species);
         formula_matrix_inert_solid = submatrix(system.formulaMatrix(), indices_inert_solid_elements, indices_inert_solid_species);
+
+        formula_matrices_updated = true;
     }
 };
 
@@ -569,46 +591,55 @@ auto Partition::indicesInertSolidElements() const -> const Indices&
 
 auto Partition::formulaMatrixEquilibriumPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_equilibrium;
 }
 
 auto Partition::formulaMatrixEquilibriumFluidPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_equilibrium_fluid;
 }
 
 auto Partition::formulaMatrixEquilibriumSolidPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_equilibrium_solid;
 }
 
 auto Partition::formulaMatrixKineticPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_kinetic;
 }
 
 auto Partition::formulaMatrixKineticFluidPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_kinetic_fluid;
 }
 
 auto Partition::formulaMatrixKineticSolidPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_kinetic_solid;
 }
 
 auto Partition::formulaMatrixInertPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_inert;
 }
 
 auto Partition::formulaMatrixInertFluidPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_inert_fluid;
 }
 
 auto Partition::formulaMatrixInertSolidPartition() const -> MatrixConstRef
 {
+    pimpl->updateFormulaMatrices();
     return pimpl->formula_matrix_inert_solid;
 }
 
@@ -184,6 +184,13 @@ auto Phase::properties(PhaseChemicalModelResult& res, double T, double P, Vector
     pimpl->chemical_model(res, T, P, n);
 }
 
+auto Phase::clone() const -> Phase
+{
+    Phase phase;
+    phase.pimpl = std::make_shared<Impl>(*pimpl);
+    return phase;
+}
+
 auto operator<(const Phase& lhs, const Phase& rhs) -> bool
 {
     return lhs.name() < rhs.name();
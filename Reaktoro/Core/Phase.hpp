@@ -133,6 +133,12 @@ public:
     /// @param n The molar amounts of the species (in units of mol)
     auto properties(PhaseChemicalModelResult& res, double T, double P, VectorConstRef n) const -> void;
 
+    /// Return a deep copy of this Phase instance.
+    /// Copies of a Phase instance share the same thermodynamic and chemical model functions,
+    /// which keep internal work memory. The returned phase has its own copy of these functions
+    /// and can be used concurrently with this one (e.g., in a different thread).
+    auto clone() const -> Phase;
+
 private:
     struct Impl;
 
@@ -17,6 +17,9 @@
 
 #include "ReactionSystem.hpp"
 
+// C++ includes
+#include <unordered_map>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
@@ -52,6 +55,9 @@ struct ReactionSystem::Impl
     /// The stoichiometric matrix of the reactions w.r.t. to all species in the system
     Matrix stoichiometric_matrix;
 
+    /// The hash table mapping the names of the reactions to their indices
+    std::unordered_map<std::string, Index> reaction_indices;
+
     /// Construct a defaut ReactionSystem::Impl instance
     Impl()
     {}
@@ -62,6 +68,11 @@ struct ReactionSystem::Impl
     {
         // Initialize the stoichiometric matrix of the reactions
         stoichiometric_matrix = Reaktoro::stoichiometricMatrix(system, reactions);
+
+        // Initialize the hash table of reaction indices, keeping the first reaction with a given name
+        reaction_indices.reserve(reactions.size());
+        for(Index i = 0; i < reactions.size(); ++i)
+            reaction_indices.emplace(reactions[i].name(), i);
     }
 };
 
@@ -83,7 +94,8 @@ auto ReactionSystem::numReactions() const -> unsigned
 
 auto ReactionSystem::indexReaction(std::string name) const -> Index
 {
-    return index(name, reactions());
+    const auto it = pimpl->reaction_indices.find(name);
+    return it != pimpl->reaction_indices.end() ? it->second : numReactions();
 }
 
 auto ReactionSystem::indexReactionWithError(std::string name) const -> Index
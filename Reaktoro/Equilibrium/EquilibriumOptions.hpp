@@ -38,6 +38,11 @@ enum class GibbsHessian
 
     /// The Hessian of the Gibbs energy function is `H = diag(d(ln(x))/dn)`, where `x` is the mole fractions of the species.
     ApproximationDiagonal,
+
+    /// The Hessian of the Gibbs energy function is `H = H(exact)` represented as a diagonal plus a low-rank matrix.
+    /// The phases whose chemical models provide this representation (e.g., aqueous phases with the ideal, Debye-Huckel,
+    /// and HKF models) contribute with a few columns only, while the other phases contribute with their dense blocks.
+    ExactDiagonalLowRank,
 };
 
 /// The options for the smart equilibrium calculations.
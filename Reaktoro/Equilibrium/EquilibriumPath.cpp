@@ -18,9 +18,11 @@
 #include "EquilibriumPath.hpp"
 
 // C++ includes
+#include <limits>
 #include <list>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalOutput.hpp>
 #include <Reaktoro/Core/ChemicalPlot.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
@@ -102,11 +104,16 @@ struct EquilibriumPath::Impl
         // The chemical state updated throughout the path calculation
         ChemicalState state = state_i;
 
+        // Use the continuation method if it has been chosen
+        if(options.continuation.active)
+            return continuation(equilibrium, state, state_f);
+
+        // The previous value of t at which the ODE function was evaluated
+        double tprev = 0.0;
+
         // The ODE function describing the equilibrium path
         ODEFunction f = [&](double t, VectorConstRef ne, VectorRef res) -> int
         {
-            static double tprev = t;
-
             // Skip if t is greater or equal than 1
             if(t > 0.0 && std::abs(t - tprev) >= options.maxstep) return 1;
 
@@ -191,6 +198,149 @@ struct EquilibriumPath::Impl
 
         return result;
     }
+
+    /// Solve the path of equilibrium states between two chemical states using continuation
+    auto continuation(EquilibriumSolver& equilibrium, ChemicalState& state, const ChemicalState& state_f) -> EquilibriumPathResult
+    {
+        // The result of this equilibrium path calculation
+        EquilibriumPathResult result;
+
+        // The options for the continuation method
+        const auto& copts = options.continuation;
+
+        Assert(copts.initial_step > 0.0 && copts.min_step > 0.0,
+            "Cannot proceed with EquilibriumPath::solve to calculate the equilibrium path.",
+            "The initial and minimum step lengths of the continuation method must be positive.");
+
+        // The indices of the equilibrium species
+        const Indices& ies = partition.indicesEquilibriumSpecies();
+
+        // The temperatures, pressures and amounts of elements at the initial and final chemical states
+        const double T_i = state.temperature();
+        const double T_f = state_f.temperature();
+        const double P_i = state.pressure();
+        const double P_f = state_f.pressure();
+        const Vector be_i = state.elementAmountsInSpecies(ies);
+        const Vector be_f = state_f.elementAmountsInSpecies(ies);
+
+        // The number of phases in the system
+        const unsigned num_phases = system.numPhases();
+
+        // The trial chemical state calculated in each continuation step
+        ChemicalState trial = state;
+
+        // The sensitivity of the equilibrium state
+        EquilibriumSensitivity sensitivity;
+
+        // The tangent of the path and the predicted amounts of the equilibrium species
+        Vector tangent, ne, ne_pred;
+
+        // The stable phases at the current and trial chemical states
+        std::vector<bool> stable(num_phases), stable_trial(num_phases);
+
+        // Calculate the equilibrium state at a given point of the path and return true if successful
+        auto correct = [&](ChemicalState& s, double t)
+        {
+            const double T  = T_i + t * (T_f - T_i);
+            const double P  = P_i + t * (P_f - P_i);
+            const Vector be = be_i + t * (be_f - be_i);
+            result.equilibrium += equilibrium.solve(s, T, P, be);
+            return result.equilibrium.optimum.succeeded;
+        };
+
+        // Determine the stable phases in a chemical state
+        auto assemblage = [&](const ChemicalState& s, std::vector<bool>& res)
+        {
+            const double total = s.speciesAmounts().sum();
+            for(unsigned i = 0; i < num_phases; ++i)
+                res[i] = s.phaseAmount(i) > copts.phase_tolerance * total;
+        };
+
+        // Update the tangent of the path using the sensitivity of the equilibrium state
+        auto update = [&]()
+        {
+            sensitivity = equilibrium.sensitivity();
+            tangent = sensitivity.dndT * (T_f - T_i) +
+                      sensitivity.dndP * (P_f - P_i) +
+                      sensitivity.dndb * (be_f - be_i);
+            ne = rows(state.speciesAmounts(), ies);
+            assemblage(state, stable);
+        };
+
+        // Calculate the equilibrium state at the beginning of the path
+        Assert(correct(state, 0.0),
+            "Cannot proceed with EquilibriumPath::solve to calculate the equilibrium path.",
+            "The equilibrium calculation at the initial state failed.");
+
+        update();
+
+        // Initialize the output and plots of the equilibrium path calculation with the initial state
+        if(output) output.open();
+        for(auto& plot : plots) plot.open();
+
+        if(output) output.update(state, 0.0);
+        for(auto& plot : plots) plot.update(state, 0.0);
+
+        double t = 0.0;
+        double h = copts.initial_step;
+
+        while(t < 1.0)
+        {
+            // Bound the step length by the maximum one and the end of the path
+            h = std::min(h, options.maxstep);
+            const double dt = std::min(h, 1.0 - t);
+
+            // Predict the amounts of equilibrium species with the tangent of the path
+            ne_pred = (ne + dt * tangent).cwiseMax(0.0);
+            trial = state;
+            trial.setSpeciesAmounts(ne_pred, ies);
+
+            // Correct the prediction with an equilibrium calculation
+            const bool succeeded = correct(trial, t + dt);
+
+            // Calculate the deviation of the prediction from the corrected amounts
+            const Vector ne_trial = rows(trial.speciesAmounts(), ies);
+            const double deviation = succeeded ?
+                (ne_trial - ne_pred).lpNorm<Eigen::Infinity>() / std::max(ne_trial.lpNorm<Eigen::Infinity>(), 1e-300) :
+                std::numeric_limits<double>::infinity();
+
+            // Check if the assemblage of stable phases has changed in the step
+            assemblage(trial, stable_trial);
+            const bool changed = stable_trial != stable;
+
+            // Reject the step if the deviation is too large, or bisect it if the assemblage has changed
+            if(dt > copts.min_step && (deviation > copts.tolerance || changed))
+            {
+                h = deviation > copts.tolerance ?
+                    std::max(dt * std::max(0.9 * std::sqrt(copts.tolerance/deviation), 0.1), copts.min_step) :
+                    std::max(0.5 * dt, copts.min_step);
+                continue;
+            }
+
+            Assert(succeeded,
+                "Cannot proceed with EquilibriumPath::solve to calculate the equilibrium path.",
+                "The equilibrium calculation failed with the minimum step length.");
+
+            // Count the steps accepted only because the minimum step length was reached
+            if(deviation > copts.tolerance)
+                ++result.num_inaccurate_steps;
+
+            // Accept the step and update the tangent of the path
+            ++result.num_steps;
+            t = dt < 1.0 - t ? t + dt : 1.0;
+            state = trial;
+            update();
+
+            // Update the output and plots with the new state
+            if(output) output.update(state, t);
+            for(auto& plot : plots) plot.update(state, t);
+
+            // Increase the step length according to the curvature of the path
+            h = dt * std::min(0.9 * std::sqrt(copts.tolerance/std::max(deviation, 1e-12)), 2.0);
+        }
+
+        return result;
+    }
 };
 
 EquilibriumPath::EquilibriumPath(const ChemicalSystem& system)
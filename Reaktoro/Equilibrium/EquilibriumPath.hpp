@@ -36,6 +36,29 @@ class ChemicalSystem;
 class ChemicalState;
 class Partition;
 
+/// A struct that describes the options for the continuation method of an equilibrium path calculation.
+/// In the continuation method, the equilibrium state at the next point of the path is predicted using the
+/// sensitivity of the current one and then corrected with an equilibrium calculation. The step length
+/// is adapted to the curvature of the path, and steps in which the assemblage of stable phases changes
+/// are bisected until the change is located within the minimum step length.
+struct EquilibriumPathContinuationOptions
+{
+    /// The boolean flag that indicates if the continuation method is used instead of the ODE solver.
+    bool active = false;
+
+    /// The initial step length of the continuation.
+    double initial_step = 0.01;
+
+    /// The minimum step length of the continuation, used to locate changes in the assemblage of stable phases.
+    double min_step = 1e-6;
+
+    /// The tolerance for the relative deviation between the predicted and corrected amounts of the species.
+    double tolerance = 1e-2;
+
+    /// The relative amount of a phase above which it is considered stable.
+    double phase_tolerance = 1e-10;
+};
+
 /// A struct that describes the options from an equilibrium path calculation.
 struct EquilibriumPathOptions
 {
@@ -45,6 +68,9 @@ struct EquilibriumPathOptions
     /// The options for the ODE solver
     ODEOptions ode;
 
+    /// The options for the continuation method
+    EquilibriumPathContinuationOptions continuation;
+
     /// The maximum step length during the equilibrium path calculation.
     double maxstep = 0.1;
 };
@@ -54,9 +80,19 @@ struct EquilibriumPathResult
 {
     /// The accumulated result of the equilibrium calculations.
     EquilibriumResult equilibrium;
+
+    /// The number of accepted steps of the continuation method.
+    unsigned num_steps = 0;
+
+    /// The number of steps of the continuation method accepted with the minimum step length although the deviation
+    /// between predicted and corrected amounts exceeded the tolerance. This happens where the path is not smooth,
+    /// e.g., where the assemblage of stable phases changes, but a large number indicates a too large minimum step.
+    unsigned num_inaccurate_steps = 0;
 };
 
 /// A class that describes a path of equilibrium states.
+/// EquilibriumPath instances used concurrently in different threads must be constructed
+/// with different clones of a chemical system (see ChemicalSystem::clone).
 class EquilibriumPath
 {
 public:
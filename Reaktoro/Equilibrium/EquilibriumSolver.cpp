@@ -24,6 +24,7 @@
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateView.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Connectivity.hpp>
 #include <Reaktoro/Core/Partition.hpp>
@@ -32,6 +33,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumProblem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Thermodynamics/Models/ChemicalModel.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
 #include <Reaktoro/Optimization/OptimumOptions.hpp>
 #include <Reaktoro/Optimization/OptimumProblem.hpp>
@@ -208,7 +210,8 @@ struct EquilibriumSolver::Impl
     }
 
     /// Update the OptimumProblem instance with given EquilibriumProblem and ChemicalState instances
-    auto updateOptimumProblem(const ChemicalState& state) -> void
+    template<typename State>
+    auto updateOptimumProblem(const State& state) -> void
     {
         // The temperature and pressure of the equilibrium calculation
         const auto T  = state.temperature();
@@ -268,6 +271,9 @@ struct EquilibriumSolver::Impl
                 res.hessian.mode = Hessian::Diagonal;
                 res.hessian.diagonal = diagonal(xe.ddn)/xe.val;
                 break;
+            case GibbsHessian::ExactDiagonalLowRank:
+                updateHessianDiagonalLowRank(res.hessian);
+                break;
             }
 
             return res;
@@ -280,8 +286,72 @@ struct EquilibriumSolver::Impl
         optimum_problem.l.setConstant(Ne, options.epsilon);
     }
 
+    /// Update the Hessian of the Gibbs energy function as a diagonal plus a low-rank matrix
+    auto updateHessianDiagonalLowRank(Hessian& hessian) -> void
+    {
+        // The chemical properties of the phases and the molar derivatives of the ln activities of the species
+        const ChemicalModelResult& cres = properties.chemicalModelResult();
+        const auto ddn = properties.lnActivities().ddn;
+
+        // The number of species, phases, and equilibrium species
+        const Index N = system.numSpecies();
+        const Index Np = system.numPhases();
+        const Index Ne = ies.size();
+
+        // The position of every species in the equilibrium partition (or Ne if not an equilibrium species)
+        Indices ipos(N, Ne);
+        for(Index i = 0; i < Ne; ++i)
+            ipos[ies[i]] = i;
+
+        // The number of low-rank columns, which is the number of species in a phase whose chemical model
+        // does not provide its diagonal plus low-rank representation (zero for single-species phases)
+        Index ncols = 0;
+        for(Index iphase = 0; iphase < Np; ++iphase)
+        {
+            const DiagonalLowRankMatrix& lr = cres.phaseLnActivitiesLowRank(iphase);
+            const Index size = system.numSpeciesInPhase(iphase);
+            ncols += lr.D.size() ? lr.U.cols() : (size > 1 ? size : 0);
+        }
+
+        hessian.mode = Hessian::DiagonalLowRank;
+        hessian.diagonal.resize(Ne);
+        hessian.U.setZero(Ne, ncols);
+        hessian.V.setZero(Ne, ncols);
+
+        Index k = 0;
+        for(Index iphase = 0; iphase < Np; ++iphase)
+        {
+            const DiagonalLowRankMatrix& lr = cres.phaseLnActivitiesLowRank(iphase);
+            const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
+            const Index size = system.numSpeciesInPhase(iphase);
+            const auto block = ddn.block(ifirst, ifirst, size, size);
+            const Index cols = lr.D.size() ? lr.U.cols() : (size > 1 ? size : 0);
+            for(Index j = 0; j < size; ++j)
+            {
+                const Index i = ipos[ifirst + j];
+                if(i == Ne) continue;
+                if(lr.D.size())
+                {
+                    hessian.diagonal[i] = lr.D[j];
+                    hessian.U.row(i).segment(k, cols) = lr.U.row(j);
+                    hessian.V.row(i).segment(k, cols) = lr.V.row(j);
+                }
+                else
+                {
+                    hessian.diagonal[i] = block(j, j);
+                    if(cols == 0) continue;
+                    hessian.U.row(i).segment(k, cols) = block.row(j);
+                    hessian.U(i, k + j) -= block(j, j);
+                    hessian.V(i, k + j) = 1.0;
+                }
+            }
+            k += cols;
+        }
+    }
+
     /// Initialize the optimum state from a chemical state
-    auto updateOptimumState(const ChemicalState& state) -> void
+    template<typename State>
+    auto updateOptimumState(const State& state) -> void
     {
         // The temperature and the RT factor
         const double T  = state.temperature();
@@ -303,7 +373,8 @@ struct EquilibriumSolver::Impl
     }
 
     /// Initialize the chemical state from a optimum state
-    auto updateChemicalState(ChemicalState& state) -> void
+    template<typename State>
+    auto updateChemicalState(State& state) -> void
     {
         // The temperature and the RT factor
         const double T  = state.temperature();
@@ -333,7 +404,8 @@ struct EquilibriumSolver::Impl
     }
 
     /// Find a feasible approximation for an equilibrium problem.
-    auto approximate(ChemicalState& state, double T, double P, Vector be) -> EquilibriumResult
+    template<typename State>
+    auto approximate(State& state, double T, double P, Vector be) -> EquilibriumResult
     {
         // Check the dimension of the vector `be`
         Assert(unsigned(be.rows()) == Ee,
@@ -404,7 +476,8 @@ struct EquilibriumSolver::Impl
     }
 
     /// Find an initial guess for an equilibrium problem.
-    auto initialguess(ChemicalState& state, double T, double P, Vector be) -> EquilibriumResult
+    template<typename State>
+    auto initialguess(State& state, double T, double P, Vector be) -> EquilibriumResult
     {
         // Solve the linear programming problem to obtain an approximation
         auto result = approximate(state, T, P, be);
@@ -429,7 +502,8 @@ struct EquilibriumSolver::Impl
     }
 
     /// Return true if cold-start is needed.
-    auto coldstart(const ChemicalState& state) -> bool
+    template<typename State>
+    auto coldstart(const State& state) -> bool
     {
         // Check if all equilibrium species have zero amounts
         bool zero = true;
@@ -440,7 +514,8 @@ struct EquilibriumSolver::Impl
     }
 
     /// Solve the equilibrium problem
-    auto solve(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumResult
+    template<typename State>
+    auto solve(State& state, double T, double P, VectorConstRef be) -> EquilibriumResult
     {
         // Check the dimension of the vector `be`
         Assert(be.size() == static_cast<int>(Ee),
@@ -452,7 +527,8 @@ struct EquilibriumSolver::Impl
     }
 
     /// Solve the equilibrium problem
-    auto solve(ChemicalState& state, double T, double P, const double* b) -> EquilibriumResult
+    template<typename State>
+    auto solve(State& state, double T, double P, const double* b) -> EquilibriumResult
     {
         // Set the molar amounts of the elements
         be = Vector::Map(b, Ee);
@@ -619,6 +695,11 @@ auto EquilibriumSolver::solve(ChemicalState& state, double T, double P, const do
     return pimpl->solve(state, T, P, be);
 }
 
+auto EquilibriumSolver::solve(ChemicalStateView state, double T, double P, VectorConstRef be) -> EquilibriumResult
+{
+    return pimpl->solve(state, T, P, be);
+}
+
 auto EquilibriumSolver::solve(ChemicalState& state) -> EquilibriumResult
 {
     return solve(state, state.temperature(), state.pressure(), state.elementAmounts());
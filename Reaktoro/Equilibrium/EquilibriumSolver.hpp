@@ -28,6 +28,7 @@ namespace Reaktoro {
 // Forward declarations
 class ChemicalProperties;
 class ChemicalState;
+class ChemicalStateView;
 class ChemicalSystem;
 class Partition;
 class EquilibriumProblem;
@@ -36,6 +37,9 @@ struct EquilibriumResult;
 struct EquilibriumSensitivity;
 
 /// A solver class for solving chemical equilibrium calculations.
+/// An EquilibriumSolver instance cannot be used concurrently in different threads. Different
+/// instances can, as long as their chemical systems do not share models, which is the case for
+/// instances constructed with different clones of a chemical system (see ChemicalSystem::clone).
 class EquilibriumSolver
 {
 public:
@@ -86,6 +90,13 @@ public:
     /// @param be The molar amounts of the elements in the equilibrium partition
     auto solve(ChemicalState& state, double T, double P, const double* be) -> EquilibriumResult;
 
+    /// Solve an equilibrium problem with given molar amounts of the elements in the equilibrium partition.
+    /// @param state[in,out] The view of the initial guess and the final state of the equilibrium calculation
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param be The molar amounts of the elements in the equilibrium partition
+    auto solve(ChemicalStateView state, double T, double P, VectorConstRef be) -> EquilibriumResult;
+
     /// Solve an equilibrium problem with given equilibrium problem.
     /// @param state[in,out] The initial guess and the final state of the equilibrium calculation
     /// @param problem The equilibrium problem with given temperature, pressure, and element amounts.
@@ -35,6 +35,8 @@ class EquilibriumProblem;
 struct EquilibriumResult;
 
 /// A class used to perform equilibrium calculations using machine learning scheme.
+/// The same restrictions of EquilibriumSolver apply to the use of SmartEquilibriumSolver
+/// instances in different threads.
 class SmartEquilibriumSolver
 {
 public:
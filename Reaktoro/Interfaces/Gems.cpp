@@ -18,6 +18,7 @@
 #include "Gems.hpp"
 
 // C++ includes
+#include <limits>
 #include <map>
 #include <set>
 #include <vector>
@@ -116,12 +117,85 @@ struct Gems::Impl
     /// The unique names of the species
     std::vector<std::string> species_names;
 
+    /// The name of the file used to initialize the GEMS `node` member
+    std::string filename;
+
     /// Construct a default Impl instance
     Impl()
     {}
 
+    /// Calculate the molar derivatives of the ln activity coefficients of the species.
+    /// These are calculated with forward finite differences on the amounts of the species.
+    /// Since the activity coefficients of a phase do not depend on the amounts of species
+    /// in other phases, one species of every phase is perturbed at the same time, so that
+    /// the number of evaluations is the number of species in the largest phase.
+    auto lnActivityCoefficientsDerivatives(const Gems& gems, MatrixRef ln_g_ddn) -> void
+    {
+        const Index num_species = gems.numSpecies();
+        const Index num_phases = gems.numPhases();
+        const double sqrt_eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+        ACTIVITY* ap = node->pActiv()->GetActivityDataPtr();
+
+        ln_g_ddn.setZero();
+
+        // The ln activity coefficients of the species at the current amounts
+        const Vector ln_g = Vector::Map(ap->lnGam, num_species);
+
+        // The index of the first species, the number of species and the perturbation of each phase
+        Indices offsets(num_phases), sizes(num_phases);
+        Vector steps(num_phases);
+        Index max_size = 0;
+        for(Index iphase = 0, offset = 0; iphase < num_phases; ++iphase)
+        {
+            offsets[iphase] = offset;
+            sizes[iphase] = gems.numSpeciesInPhase(iphase);
+            steps[iphase] = sqrt_eps * sum(n.segment(offset, sizes[iphase]));
+            if(sizes[iphase] > 1)
+                max_size = std::max(max_size, sizes[iphase]);
+            offset += sizes[iphase];
+        }
+
+        Vector nh = n;
+        for(Index k = 0; k < max_size; ++k)
+        {
+            // Perturb the amount of the k-th species of every phase with more than one species
+            for(Index iphase = 0; iphase < num_phases; ++iphase)
+                if(sizes[iphase] > 1 && k < sizes[iphase] && steps[iphase] > 0.0)
+                    nh[offsets[iphase] + k] += steps[iphase];
+
+            node->setSpeciation(nh.data());
+            node->updateConcentrations();
+            node->updateActivityCoefficients();
+
+            // Set the k-th column of the derivatives of every phase and undo its perturbation
+            for(Index iphase = 0; iphase < num_phases; ++iphase)
+            {
+                if(sizes[iphase] > 1 && k < sizes[iphase] && steps[iphase] > 0.0)
+                {
+                    const Index offset = offsets[iphase];
+                    const Index size = sizes[iphase];
+                    ln_g_ddn.col(offset + k).segment(offset, size) =
+                        (Vector::Map(ap->lnGam + offset, size) - ln_g.segment(offset, size))/steps[iphase];
+                    nh[offset + k] = n[offset + k];
+                }
+            }
+        }
+
+        // Restore the state of the GEMS node at the current species amounts
+        if(max_size > 0)
+        {
+            node->setSpeciation(n.data());
+            node->updateConcentrations();
+            node->updateActivityCoefficients();
+            node->updateChemicalPotentials();
+            node->updateActivities();
+        }
+    }
+
     /// Construct a default Impl instance
     Impl(std::string filename)
+    : filename(filename)
     {
         // Initialize the GEMS `node` member
         node = std::make_shared<TNode>();
@@ -313,11 +387,27 @@ auto Gems::properties(ChemicalModelResult& res, double T, double P, VectorConstR
 
         offset += size;
     }
+
+    // Set the molar derivatives of the ln activity coefficients and add them to d(ln(a))/dn
+    if(pimpl->options.activity_coefficient_derivatives)
+    {
+        pimpl->lnActivityCoefficientsDerivatives(*this, res.lnActivityCoefficients().ddn);
+        res.lnActivities().ddn += res.lnActivityCoefficients().ddn;
+    }
 }
 
 auto Gems::clone() const -> std::shared_ptr<Interface>
 {
-    return std::make_shared<Gems>(*this);
+    // Initialize a new GEMS node from the same file used to initialize this instance
+    if(pimpl->filename.empty())
+        return std::make_shared<Gems>();
+    std::shared_ptr<Gems> gems = std::make_shared<Gems>(pimpl->filename);
+
+    // Set the options, temperature, pressure and species amounts of this instance
+    gems->setOptions(pimpl->options);
+    gems->set(temperature(), pressure(), speciesAmounts());
+
+    return gems;
 }
 
 auto Gems::set(double T, double P) -> void
@@ -30,6 +30,12 @@ struct GemsOptions
 {
     /// The flag that indicates if smart start initial approximation is used
     bool warmstart = true;
+
+    /// The flag that indicates if the molar derivatives of the activities account for the activity coefficients.
+    /// If false, the molar derivatives of the activities are approximated by those of the mole fractions.
+    /// The derivatives of the activity coefficients are calculated with finite differences, with as many
+    /// evaluations of the activity models as species in the largest phase.
+    bool activity_coefficient_derivatives = false;
 };
 
 /// A wrapper class for Gems code
@@ -94,7 +100,9 @@ public:
     /// @param n The amounts of the species (in units of mol)
     virtual auto properties(ChemicalModelResult& res, double T, double P, VectorConstRef n) -> void;
 
-    /// Return a clone of this Gems instance
+    /// Return a clone of this Gems instance.
+    /// The clone has its own GEMS node, initialized from the same file of this instance,
+    /// so that both can be used concurrently in different threads.
     virtual auto clone() const -> std::shared_ptr<Interface>;
 
     /// Set the temperature and pressure of the Gems instance.
@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <map>
+#include <mutex>
 #include <vector>
 
 // Reaktoro includes
@@ -52,6 +53,59 @@ auto speciesInPhase(const Interface& interface, std::vector<Species> species, In
     return std::vector<Species>(begin, end);
 }
 
+/// A thread-safe pool of Interface instances used in the models of a chemical system.
+/// Each evaluation of a model uses an instance that is not in use by other threads,
+/// which is created as a clone of the pool's original instance when none is available.
+/// The instances are reused in later evaluations, so that a pool has as many instances
+/// as the maximum number of threads that evaluated the models at the same time.
+class InterfacePool
+{
+public:
+    /// Construct an InterfacePool instance with the original instance to be cloned.
+    /// The original instance is never evaluated, so that it can be cloned at any time.
+    explicit InterfacePool(std::shared_ptr<Interface> interface)
+    : interface(interface)
+    {}
+
+    /// Apply a function on an Interface instance that is not in use by other threads.
+    template<typename Function>
+    auto apply(const Function& function) -> void
+    {
+        std::shared_ptr<Interface> instance = acquire();
+        try { function(*instance); }
+        catch(...) { release(instance); throw; }
+        release(instance);
+    }
+
+private:
+    /// Return an Interface instance of the pool that is not in use, creating one if needed.
+    auto acquire() -> std::shared_ptr<Interface>
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(available.empty())
+            return interface->clone();
+        std::shared_ptr<Interface> instance = available.back();
+        available.pop_back();
+        return instance;
+    }
+
+    /// Return an Interface instance to the pool after its use.
+    auto release(const std::shared_ptr<Interface>& instance) -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        available.push_back(instance);
+    }
+
+    /// The original Interface instance from which all others are cloned
+    std::shared_ptr<Interface> interface;
+
+    /// The Interface instances that are not in use by any thread
+    std::vector<std::shared_ptr<Interface>> available;
+
+    /// The mutex that protects the instances of the pool
+    std::mutex mutex;
+};
+
 } // namespace
 
 Interface::~Interface()
@@ -129,6 +183,9 @@ auto Interface::system() const -> ChemicalSystem
     // to be used in the lambda functions below.
     std::shared_ptr<Interface> interface = clone();
 
+    // Create the pool of clones of the Interface instance, one for each thread evaluating the models below
+    std::shared_ptr<InterfacePool> pool = std::make_shared<InterfacePool>(interface);
+
     // Create the Element instances
     std::vector<Element> elements(nelements);
     for(unsigned i = 0; i < nelements; ++i)
@@ -173,17 +230,17 @@ auto Interface::system() const -> ChemicalSystem
     // Create the ThermoModel function for the chemical system
     ThermoModel thermo_model = [=](ThermoModelResult& res, Temperature T, Pressure P) -> void
     {
-        interface->properties(res, T, P);
+        pool->apply([&](Interface& instance) { instance.properties(res, T, P); });
     };
 
     // Create the ChemicalModel function for the chemical system
     ChemicalModel chemical_model = [=](ChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) -> void
     {
-        interface->properties(res, T, P, n);
+        pool->apply([&](Interface& instance) { instance.properties(res, T, P, n); });
     };
 
-    // Create the ChemicalSystem instance
-    ChemicalSystem system(phases, thermo_model, chemical_model);
+    // Create the ChemicalSystem instance, whose models can be evaluated concurrently
+    ChemicalSystem system(phases, thermo_model, chemical_model, true);
 
     return system;
 }
@@ -18,7 +18,9 @@
 #include "Phreeqc.hpp"
 
 // C++ includes
+#include <limits>
 #include <map>
+#include <tuple>
 
 // Eigen includes
 #include <Reaktoro/deps/eigen3/Eigen/Dense>
@@ -90,12 +92,22 @@ struct Phreeqc::Impl
     // The current ionic strength in PHREEQC (in units of molal)
     double I;
 
+    // The temperature and pressure of the last update of the properties with T and P dependency
+    double thermo_T = std::numeric_limits<double>::quiet_NaN();
+    double thermo_P = std::numeric_limits<double>::quiet_NaN();
+
     // The current molar amounts of all species in PHREEQC (in units of mol)
     Vector n;
 
     // The name of the database file loaded into this instance
     std::string database;
 
+    // The options of this instance
+    PhreeqcOptions options;
+
+    // The input scripts executed after loading the database, in the order of their execution
+    std::vector<std::string> inputs;
+
     // The set of elements composing the species
     std::vector<element*> elements;
 
@@ -310,6 +322,13 @@ struct Phreeqc::Impl
 
     // Return the natural logarithm of the activities of the species
     auto lnActivities() -> Vector;
+
+    // Calculate the molar derivatives of the ln activity coefficients and ln activities of the species
+    auto lnActivitiesDerivatives(MatrixRef ln_g_ddn, MatrixRef ln_a_ddn) -> void;
+
+    // Return the ln activity coefficients of the aqueous species and the ln activity of water
+    // evaluated with the Pitzer or SIT model at the current molalities of the aqueous species
+    auto lnActivityCoefficientsPitzerSit() -> std::tuple<Vector, double>;
 };
 
 Phreeqc::Impl::Impl()
@@ -339,6 +358,9 @@ auto Phreeqc::Impl::execute(std::string input, std::string output) -> void
     // Execute the given input script file
     PhreeqcUtils::execute(phreeqc, input, output);
 
+    // Record the input script so that clones of this instance can execute it too
+    inputs.push_back(input);
+
     // Initialize the data members after executing the PHREEQC script
     initialize();
 }
@@ -680,6 +702,9 @@ void Phreeqc::Impl::initializeChemicalState()
          PhreeqcUtils::speciesAmounts(phreeqc, gaseous_species),
          PhreeqcUtils::speciesAmounts(phreeqc, mineral_species);
 
+    // Ensure the properties with T and P dependency are updated for the new species
+    thermo_T = thermo_P = std::numeric_limits<double>::quiet_NaN();
+
     // Initialize thermodynamic and chemical properties
     set(T, P, n);
 }
@@ -730,6 +755,14 @@ auto Phreeqc::Impl::set(double T, double P, const Vector& n) -> void
 
 auto Phreeqc::Impl::updateThermoProperties() -> void
 {
+    // Skip the update if temperature and pressure have not changed since the last one,
+    // as it happens in every evaluation of the chemical model during an equilibrium solve
+    if(T == thermo_T && P == thermo_P)
+        return;
+
+    thermo_T = T;
+    thermo_P = P;
+
     // Set ionic strength to zero to eliminate ionic strength corrections in
     // the equilibrium constants of reactions. These ionic strength corrections
     // are used as contributions in the activities of the species, which are
@@ -758,14 +791,27 @@ auto Phreeqc::Impl::updateChemicalProperties() -> void
 {
     // Update equilibrium constants of reactions with T, P, and I corrections.
     // This Phreeqc::k_temp call also updates density and dielectric
-    // properties of water at the given T and P conditions.
+    // properties of water at the given T and P conditions. The ionic strength
+    // of its last call is invalidated so that it skips the calculation only
+    // if the equilibrium constants do not depend on ionic strength, instead
+    // of whenever ionic strength changed by less than its own tolerance.
+    phreeqc.current_mu = std::numeric_limits<double>::quiet_NaN();
     phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
 
-    // Update the standard Gibbs energies of the species with T, P, and I corrections
-    standard_molar_gibbs_energies_TPI = speciesMolarGibbsEnergies();
+    if(phreeqc.mu_terms_in_logk)
+    {
+        // Update the standard Gibbs energies of the species with T, P, and I corrections
+        standard_molar_gibbs_energies_TPI = speciesMolarGibbsEnergies();
 
-    // Update the standard molar volumes of the species with T, P, and I corrections
-    standard_molar_volumes_TPI = speciesMolarVolumes();
+        // Update the standard molar volumes of the species with T, P, and I corrections
+        standard_molar_volumes_TPI = speciesMolarVolumes();
+    }
+    else
+    {
+        // The standard properties of the species have no I corrections
+        standard_molar_gibbs_energies_TPI = standard_molar_gibbs_energies;
+        standard_molar_volumes_TPI = standard_molar_volumes;
+    }
 
     updateAqueousProperties();
 
@@ -1121,6 +1167,175 @@ auto Phreeqc::Impl::lnActivities() -> Vector
     return ln_a;
 }
 
+auto Phreeqc::Impl::lnActivitiesDerivatives(MatrixRef ln_g_ddn, MatrixRef ln_a_ddn) -> void
+{
+    // The number of aqueous and gaseous species
+    const unsigned num_aqueous_species = aqueous_species.size();
+    const unsigned num_gaseous_species = gaseous_species.size();
+
+    // Auxiliary variables
+    const auto R = universalGasConstant;
+    const double ln_10 = std::log(10.0);
+    const double sqrt_eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    ln_g_ddn.setZero();
+    ln_a_ddn.setZero();
+
+    // Copy the molar amounts of the species, since setSpeciesAmounts changes them
+    const Vector n0 = n;
+
+    // Get the molar amounts of the aqueous species
+    const auto n_aqueous = n0.head(num_aqueous_species);
+
+    // Get data related to water
+    const double nH2O = n_aqueous[iH2O];
+    const double massH2O = nH2O * waterMolarMass;
+
+    // The derivatives of the aqueous phase are only defined for a positive amount of water
+    if(num_aqueous_species > 0 && massH2O > 0.0)
+    {
+        // Define some auxiliary alias
+        auto ln_g_aqueous_ddn = ln_g_ddn.topLeftCorner(num_aqueous_species, num_aqueous_species);
+        auto ln_a_aqueous_ddn = ln_a_ddn.topLeftCorner(num_aqueous_species, num_aqueous_species);
+
+        // The molar derivatives of the ionic strength
+        Vector I_ddn(num_aqueous_species);
+        for(unsigned j = 0; j < num_aqueous_species; ++j)
+            I_ddn[j] = 0.5 * aqueous_species[j]->z * aqueous_species[j]->z / massH2O;
+        I_ddn[iH2O] -= I/nH2O;
+
+        // The molar derivatives of the ln activity of water
+        Vector ln_aw_ddn(num_aqueous_species);
+
+        if(phreeqc.pitzer_model || phreeqc.sit_model)
+        {
+            // The activity coefficients depend on the molalities of all aqueous species,
+            // so their derivatives are calculated with forward finite differences on
+            // the amount of each aqueous species, using the same step for all of them
+            const double h = sqrt_eps * sum(n_aqueous);
+
+            Vector ln_g; double ln_aw;
+            Vector nh = n0;
+            for(unsigned j = 0; j < num_aqueous_species; ++j)
+            {
+                nh[j] += h;
+                setSpeciesAmounts(nh);
+                std::tie(ln_g, ln_aw) = lnActivityCoefficientsPitzerSit();
+                ln_g_aqueous_ddn.col(j) = (ln_g - ln_activity_coefficients_aqueous_species)/h;
+                ln_aw_ddn[j] = (ln_aw - ln_activities_aqueous_species[iH2O])/h;
+                nh[j] = n0[j];
+            }
+
+            // Restore the state of PHREEQC at the current species amounts
+            setSpeciesAmounts(n0);
+            lnActivityCoefficientsPitzerSit();
+        }
+        else
+        {
+            // The activity coefficients depend on composition only through the ionic
+            // strength, so their derivatives are calculated with the chain rule and a
+            // forward finite difference on the ionic strength
+            const double h = sqrt_eps * std::max(I, 1e-8);
+
+            phreeqc.gammas(I + h);
+            Vector ln_g_dI(num_aqueous_species);
+            for(unsigned i = 0; i < num_aqueous_species; ++i)
+                ln_g_dI[i] = (aqueous_species[i]->lg * ln_10 - ln_activity_coefficients_aqueous_species[i])/h;
+
+            // Restore the activity coefficients at the current ionic strength
+            phreeqc.gammas(I);
+
+            ln_g_aqueous_ddn = ln_g_dI * tr(I_ddn);
+
+            // The activity of water is its mole fraction
+            ln_aw_ddn = -1.0/sum(n_aqueous) * ones(num_aqueous_species);
+            ln_aw_ddn[iH2O] += 1.0/nH2O;
+        }
+
+        // The ln activities of the solutes are their ln activity coefficients plus their ln molalities
+        ln_a_aqueous_ddn = ln_g_aqueous_ddn;
+        ln_a_aqueous_ddn.col(iH2O).array() -= 1.0/nH2O;
+        for(unsigned i = 0; i < num_aqueous_species; ++i)
+        {
+            if(std::isfinite(aqueous_species[i]->lm))
+                ln_a_aqueous_ddn(i, i) += 1.0/n_aqueous[i];
+            else ln_a_aqueous_ddn.row(i).fill(0.0);
+        }
+        ln_a_aqueous_ddn.row(iH2O) = tr(ln_aw_ddn);
+
+        // The ionic strength corrections transferred from the standard Gibbs energies
+        // of the species to their activities (see lnActivities) also depend on composition
+        if(phreeqc.mu_terms_in_logk)
+        {
+            const double h = sqrt_eps * std::max(I, 1e-8);
+
+            phreeqc.mu_x = I + h;
+            phreeqc.current_mu = std::numeric_limits<double>::quiet_NaN();
+            phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
+            const Vector G0TPI_dI = (speciesMolarGibbsEnergies() - standard_molar_gibbs_energies_TPI)/h;
+
+            // Restore the equilibrium constants at the current ionic strength
+            phreeqc.mu_x = I;
+            phreeqc.current_mu = std::numeric_limits<double>::quiet_NaN();
+            phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
+
+            ln_a_ddn.leftCols(num_aqueous_species) += G0TPI_dI/(R*T) * tr(I_ddn);
+        }
+    }
+
+    // Get the molar amounts of the gaseous species
+    const auto n_gaseous = n0.segment(num_aqueous_species, num_gaseous_species);
+
+    // Calculate the total amount of moles in the gaseous phase
+    const double n_total = sum(n_gaseous);
+
+    // The derivatives of the fugacity coefficients are calculated with forward finite differences
+    if(num_gaseous_species > 0 && n_total > 0.0)
+    {
+        // Define some auxiliary alias
+        auto ln_g_gaseous_ddn = ln_g_ddn.block(num_aqueous_species, num_aqueous_species, num_gaseous_species, num_gaseous_species);
+        auto ln_a_gaseous_ddn = ln_a_ddn.block(num_aqueous_species, num_aqueous_species, num_gaseous_species, num_gaseous_species);
+
+        const double Patm = P * pascal_to_atm;
+        const double h = sqrt_eps * n_total;
+
+        for(unsigned j = 0; j < num_gaseous_species; ++j)
+        {
+            gaseous_species[j]->moles_x += h;
+            phreeqc.calc_PR(gaseous_species, Patm, T, 0.0);
+            for(unsigned i = 0; i < num_gaseous_species; ++i)
+                ln_g_gaseous_ddn(i, j) = (std::log(gaseous_species[i]->pr_phi) - ln_activity_coefficients_gaseous_species[i])/h;
+            gaseous_species[j]->moles_x = n_gaseous[j];
+        }
+
+        // Restore the fugacity coefficients at the current species amounts
+        phreeqc.calc_PR(gaseous_species, Patm, T, 0.0);
+
+        // The ln activities of the gases are their ln fugacity coefficients plus their ln mole fractions
+        ln_a_gaseous_ddn = ln_g_gaseous_ddn;
+        ln_a_gaseous_ddn.array() -= 1.0/n_total;
+        ln_a_gaseous_ddn.diagonal().array() += 1.0/n_gaseous.array();
+    }
+}
+
+auto Phreeqc::Impl::lnActivityCoefficientsPitzerSit() -> std::tuple<Vector, double>
+{
+    const unsigned num_aqueous_species = aqueous_species.size();
+    const double ln_10 = std::log(10.0);
+
+    // Calculate the activity coefficients using either Pitzer or SIT models
+    if(phreeqc.pitzer_model)
+        phreeqc.pitzer();
+    else phreeqc.sit();
+
+    // Collect the updated activity coefficients
+    Vector ln_g(num_aqueous_species);
+    for(unsigned i = 0; i < num_aqueous_species; ++i)
+        ln_g[i] = aqueous_species[i]->lg_pitzer * ln_10;
+
+    return std::make_tuple(ln_g, std::log(phreeqc.AW));
+}
+
 Phreeqc::Phreeqc()
 : pimpl(new Impl())
 {}
@@ -1217,6 +1432,11 @@ auto Phreeqc::set(double T, double P, VectorConstRef n) -> void
     pimpl->set(T, P, n);
 }
 
+auto Phreeqc::setOptions(const PhreeqcOptions& options) -> void
+{
+    pimpl->options = options;
+}
+
 auto Phreeqc::load(std::string database) -> void
 {
     // Resets this instance before loading a new database file
@@ -1235,7 +1455,10 @@ auto Phreeqc::execute(std::string input) -> void
 
 auto Phreeqc::reset() -> void
 {
+    // Keep the options of this instance, which do not depend on the loaded database
+    const PhreeqcOptions options = pimpl->options;
     pimpl.reset(new Phreeqc::Impl());
+    pimpl->options = options;
 }
 
 auto Phreeqc::reactions() const -> const std::vector<ReactionEquation>&
@@ -1319,6 +1542,13 @@ auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorCon
     res.lnActivityCoefficients().val = pimpl->ln_activity_coefficients;
     res.lnActivities().val = pimpl->ln_activities;
 
+    // Set the molar derivatives of the ln activity coefficients and ln activities of all species
+    if(pimpl->options.activity_coefficient_derivatives)
+    {
+        pimpl->lnActivitiesDerivatives(res.lnActivityCoefficients().ddn, res.lnActivities().ddn);
+        return;
+    }
+
     // The number of phases
     const Index num_phases = numPhases();
 
@@ -1342,7 +1572,19 @@ auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorCon
 
 auto Phreeqc::clone() const -> std::shared_ptr<Interface>
 {
-    return std::make_shared<Phreeqc>(*this);
+    // Load the database and execute the input scripts of this instance into a new PHREEQC instance
+    std::shared_ptr<Phreeqc> phreeqc = std::make_shared<Phreeqc>();
+    phreeqc->setOptions(pimpl->options);
+    if(pimpl->database.empty())
+        return phreeqc;
+    phreeqc->load(pimpl->database);
+    for(const std::string& input : pimpl->inputs)
+        phreeqc->execute(input);
+
+    // Set the temperature, pressure and species amounts of this instance
+    phreeqc->set(temperature(), pressure(), speciesAmounts());
+
+    return phreeqc;
 }
 
 auto Phreeqc::phreeqc() -> PHREEQC&
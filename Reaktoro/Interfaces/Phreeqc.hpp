@@ -28,6 +28,18 @@ namespace Reaktoro {
 // Forward declarations
 class ReactionEquation;
 
+/// A type that describes the options for Phreeqc
+struct PhreeqcOptions
+{
+    /// The flag that indicates if the molar derivatives of the activities account for the activity coefficients.
+    /// If false, the molar derivatives of the activities are approximated by those of the mole fractions.
+    /// The derivatives of the activity coefficients are calculated from those with respect to ionic strength,
+    /// or with finite differences on the amounts of the aqueous species for the Pitzer and SIT models,
+    /// which makes the evaluation of the chemical model more expensive. These derivatives are needed to
+    /// converge quadratically in equilibrium calculations with an exact Hessian (see GibbsHessian::Exact).
+    bool activity_coefficient_derivatives = false;
+};
+
 class Phreeqc : public Interface
 {
 public:
@@ -89,7 +101,10 @@ public:
     /// @param n The amounts of the species (in units of mol)
     virtual auto properties(ChemicalModelResult& res, double T, double P, VectorConstRef n) -> void;
 
-    /// Return a clone of this Phreeqc instance
+    /// Return a clone of this Phreeqc instance.
+    /// The clone has its own PHREEQC instance, in which the database and the input
+    /// scripts of this instance are loaded and executed again, so that both can be
+    /// used concurrently in different threads.
     virtual auto clone() const -> std::shared_ptr<Interface>;
 
     /// Set the temperature and pressure of the interfaced code.
@@ -110,6 +125,9 @@ public:
     /// @param n The composition of the species (in units of mol)
     auto set(double T, double P, VectorConstRef n) -> void;
 
+    /// Set the options of the Phreeqc instance
+    auto setOptions(const PhreeqcOptions& options) -> void;
+
     /// Load a PHREEQC database.
     /// This method will initialize the Phreeqc instance with all species and reactions
     /// found in the given database.
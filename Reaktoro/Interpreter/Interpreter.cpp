@@ -17,16 +17,29 @@
 
 #include "Interpreter.hpp"
 
+// C++ includes
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/SetUtils.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/Units.hpp>
+#include <Reaktoro/Core/ChemicalQuantity.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProblem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumUtils.hpp>
 #include <Reaktoro/Thermodynamics/Core/ChemicalEditor.hpp>
 #include <Reaktoro/Thermodynamics/Core/Database.hpp>
 
-#include <fstream>
-
 namespace Reaktoro {
 
 struct Interpreter::Impl
@@ -59,6 +72,8 @@ struct Interpreter::Impl
 		{
 			if(item.count("equilibrium"))
 				calculateEquilibrium(item["equilibrium"]);
+			if(item.count("equilibriumSweep"))
+				calculateEquilibriumSweep(item["equilibriumSweep"]);
 		}
 	}
 
@@ -78,6 +93,259 @@ struct Interpreter::Impl
 
 		states[stateref] = equilibrate(problem);
 	}
+
+	auto calculateEquilibriumSweep(json node) -> void
+	{
+		// The columns of a sweep case: temperature, pressure, and the quantity of each substance, in their given units
+		std::vector<std::string> names = {"temperature", "pressure"};
+		std::vector<std::string> units = {node["temperature"]["units"].get<std::string>(), node["pressure"]["units"].get<std::string>()};
+		std::vector<double> base = {node["temperature"]["value"], node["pressure"]["value"]};
+
+		// The molar amounts of the elements in one unit of each substance, so that the
+		// element amounts of a case are a linear combination of these vectors
+		std::vector<Vector> bunits;
+		for(auto item : node["substances"])
+		{
+			EquilibriumProblem problem(system);
+			problem.add(item["substance"], 1.0, item["units"]);
+			names.push_back(item["substance"].get<std::string>());
+			units.push_back(item["units"].get<std::string>());
+			base.push_back(item["quantity"]);
+			bunits.push_back(problem.elementAmounts());
+		}
+
+		// The sweep cases, given either in a csv file or as ranges of parameters
+		const std::vector<std::vector<double>> cases = node.count("cases") ?
+			readSweepCases(node["cases"], names, base) :
+			expandSweepParameters(node["parameters"], names, base);
+
+		const Index num_cases = cases.size();
+		const Index num_columns = names.size();
+		const Index num_elements = system.numElements();
+
+		// The temperatures, pressures, and element amounts of the cases
+		Vector T(num_cases), P(num_cases);
+		Matrix b = zeros(num_elements, num_cases);
+		for(Index i = 0; i < num_cases; ++i)
+		{
+			T[i] = units::convert(cases[i][0], units[0], "kelvin");
+			P[i] = units::convert(cases[i][1], units[1], "pascal");
+			for(Index k = 2; k < num_columns; ++k)
+				b.col(i) += cases[i][k] * bunits[k - 2];
+		}
+
+		// The scaling of each column so that the distance between cases is measured in fractions of the swept ranges
+		std::vector<double> scales(num_columns, 0.0);
+		for(Index k = 0; k < num_columns; ++k)
+		{
+			double min = cases[0][k], max = cases[0][k];
+			for(const auto& values : cases)
+			{
+				min = std::min(min, values[k]);
+				max = std::max(max, values[k]);
+			}
+			scales[k] = max > min ? 1.0/(max - min) : 0.0;
+		}
+
+		// The chemical quantities written for each case, which default to the amounts of all species
+		json output = node.count("output") ? node["output"] : json::object();
+		std::vector<std::string> quantities;
+		if(output.count("quantities"))
+			quantities = output["quantities"].get<std::vector<std::string>>();
+		else for(const Species& species : system.species())
+			quantities.push_back("speciesAmount(" + species.name() + ")");
+		const std::string filename = output.count("file") ? output["file"].get<std::string>() : "sweep.csv";
+
+		// The number of threads, where zero means as many as the hardware supports
+		Index num_threads = node.count("threads") ? node["threads"].get<Index>() : 0;
+		if(num_threads == 0)
+			num_threads = std::thread::hardware_concurrency();
+		num_threads = system.cloneable() ? std::max<Index>(1, std::min(num_threads, num_cases)) : 1;
+
+		// The species amounts and dual potentials of the converged cases, which warm-start their unsolved neighbours
+		std::vector<Vector> n(num_cases), y(num_cases), z(num_cases);
+		std::vector<Index> solved;
+		std::mutex mutex;
+
+		// The rows of the output file, one for each case
+		std::vector<std::vector<double>> rows(num_cases);
+
+		// Return the converged case nearest to a given case, or the number of cases if none has converged yet
+		auto nearest = [&](Index i) -> Index
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			Index jmin = num_cases;
+			double dmin = 0.0;
+			for(Index j : solved)
+			{
+				double d = 0.0;
+				for(Index k = 0; k < num_columns; ++k)
+					d += std::pow((cases[i][k] - cases[j][k]) * scales[k], 2);
+				if(jmin == num_cases || d < dmin)
+					{ jmin = j; dmin = d; }
+			}
+			return jmin;
+		};
+
+		// The index of the next case to be solved by any thread
+		std::atomic<Index> next(0);
+
+		// The exceptions thrown in each thread, to be rethrown in the calling thread
+		std::vector<std::exception_ptr> errors(num_threads);
+
+		// The work of each thread, which solves one case at a time with its own solver until none remains
+		auto work = [&](Index ithread)
+		{
+			try
+			{
+				// Each thread owns a deep copy of the chemical system so that its models are not evaluated concurrently
+				const ChemicalSystem worker_system = ithread == 0 ? system : system.clone();
+				EquilibriumSolver solver(worker_system);
+				ChemicalState state(worker_system);
+				ChemicalQuantity quantity(worker_system);
+
+				for(Index i = next++; i < num_cases; i = next++)
+				{
+					// Start from the nearest solved case, if any, otherwise from scratch
+					const Index j = nearest(i);
+					const bool warm = j < num_cases;
+					if(warm)
+					{
+						state.setSpeciesAmounts(n[j]);
+						state.setElementDualPotentials(y[j]);
+						state.setSpeciesDualPotentials(z[j]);
+					}
+					else state.setSpeciesAmounts(0.0);
+
+					EquilibriumResult result = solver.solve(state, T[i], P[i], b.col(i));
+
+					// Restart from scratch if the warm-started calculation failed
+					if(warm && !result.optimum.succeeded)
+					{
+						state.setSpeciesAmounts(0.0);
+						result = solver.solve(state, T[i], P[i], b.col(i));
+					}
+
+					auto& row = rows[i];
+					row = cases[i];
+					row.push_back(result.optimum.succeeded);
+					row.push_back(result.optimum.iterations);
+					quantity.update(state);
+					for(const std::string& str : quantities)
+						row.push_back(quantity.value(str));
+
+					// Only converged cases are used to warm-start their neighbours
+					if(!result.optimum.succeeded)
+						continue;
+
+					std::lock_guard<std::mutex> lock(mutex);
+					n[i] = state.speciesAmounts();
+					y[i] = state.elementDualPotentials();
+					z[i] = state.speciesDualPotentials();
+					solved.push_back(i);
+				}
+			}
+			catch(...)
+			{
+				errors[ithread] = std::current_exception();
+				next = num_cases;
+			}
+		};
+
+		// Start the additional threads and use the calling thread as the first one
+		std::vector<std::thread> threads;
+		for(Index ithread = 1; ithread < num_threads; ++ithread)
+			threads.emplace_back(work, ithread);
+		work(0);
+
+		for(std::thread& thread : threads)
+			thread.join();
+
+		for(const std::exception_ptr& error : errors)
+			if(error) std::rethrow_exception(error);
+
+		// Write all cases in one file with a column for each parameter and quantity
+		std::ofstream file(filename);
+		Assert(file.is_open(), "Cannot write the results of the equilibrium sweep.",
+			"The file `" + filename + "` could not be opened.");
+		file << join(names, ",") << ",succeeded,iterations," << join(quantities, ",") << std::endl;
+		file << std::setprecision(12);
+		for(const auto& row : rows)
+		{
+			for(Index k = 0; k < row.size(); ++k)
+				file << (k > 0 ? "," : "") << row[k];
+			file << std::endl;
+		}
+	}
+
+	/// Return the index of a sweep column, which is either temperature, pressure, or a listed substance.
+	static auto sweepColumn(std::string name, const std::vector<std::string>& names) -> Index
+	{
+		const Index icol = index(name, names);
+		Assert(icol < names.size(), "Cannot execute the equilibrium sweep.",
+			"The swept parameter `" + name + "` is neither temperature, pressure, nor a listed substance.");
+		return icol;
+	}
+
+	/// Return the sweep cases in a csv file with a header of column names, where missing columns take their base values.
+	static auto readSweepCases(std::string filename, const std::vector<std::string>& names, const std::vector<double>& base) -> std::vector<std::vector<double>>
+	{
+		std::ifstream file(filename);
+		Assert(file.is_open(), "Cannot read the cases of the equilibrium sweep.",
+			"The file `" + filename + "` could not be opened.");
+
+		std::string line;
+		std::getline(file, line);
+		std::vector<Index> icols;
+		for(const std::string& name : splitrim(line, ","))
+			icols.push_back(sweepColumn(name, names));
+
+		std::vector<std::vector<double>> cases;
+		while(std::getline(file, line))
+		{
+			const auto words = splitrim(line, ",");
+			if(words.empty())
+				continue;
+			Assert(words.size() == icols.size(), "Cannot read the cases of the equilibrium sweep.",
+				"The line `" + line + "` in the file `" + filename + "` does not have one value per column.");
+			cases.push_back(base);
+			for(Index k = 0; k < icols.size(); ++k)
+				cases.back()[icols[k]] = tofloat(words[k]);
+		}
+		return cases;
+	}
+
+	/// Return the sweep cases in the cartesian product of the given parameter values, where the first parameter varies slowest.
+	static auto expandSweepParameters(json node, const std::vector<std::string>& names, const std::vector<double>& base) -> std::vector<std::vector<double>>
+	{
+		std::vector<std::vector<double>> cases = {base};
+		for(auto item : node)
+		{
+			const Index icol = sweepColumn(item["name"], names);
+
+			std::vector<double> values;
+			if(item.count("values"))
+				values = item["values"].get<std::vector<double>>();
+			else
+			{
+				const double start = item["start"];
+				const double stop = item["stop"];
+				const Index num = item["num"];
+				for(Index k = 0; k < num; ++k)
+					values.push_back(num > 1 ? start + k*(stop - start)/(num - 1) : start);
+			}
+
+			std::vector<std::vector<double>> expanded;
+			for(const auto& values0 : cases)
+				for(double value : values)
+				{
+					expanded.push_back(values0);
+					expanded.back()[icol] = value;
+				}
+			cases = std::move(expanded);
+		}
+		return cases;
+	}
 };
 
 Interpreter::Interpreter()
@@ -33,6 +33,19 @@ class ChemicalState;
 class ChemicalSystem;
 
 /// Used to interpret json files containing defined calculations.
+/// A calculation is either an `equilibrium` block, whose state is saved
+/// under its `stateReference`, or an `equilibriumSweep` block, which solves
+/// the same equilibrium problem for many cases and writes one row per case
+/// in a csv file. The cases of a sweep are the cartesian product of the
+/// `parameters` (each with a `name` and either `values` or `start`, `stop`,
+/// and `num`), or the rows of a `cases` csv file whose header names the
+/// columns. A parameter is `temperature`, `pressure`, or one of the listed
+/// substances, in the units of that entry. The cases are solved by `threads`
+/// threads (zero for all available), each with its own equilibrium solver,
+/// and each case is warm-started from the nearest converged case. Near phase
+/// boundaries, the converged state may therefore depend on the order in which
+/// the cases were solved. See demos/json for examples.
+/// Different Interpreter instances can be used concurrently in different threads.
 class Interpreter
 {
 public:
@@ -30,6 +30,83 @@ struct KineticOutputOptions
     std::string format;
 };
 
+/// A struct to describe the options for the smart evaluation of kinetic rates.
+/// In a smart evaluation, the rates of the reactions are predicted with a first-order Taylor
+/// expansion around previously calculated ones, and fully evaluated only when no previous
+/// evaluation is close enough to the current chemical state. Only the evaluation of the rate
+/// laws is avoided: the equilibrium state and the chemical properties of the system are still
+/// calculated in every evaluation, so this pays off for expensive rate laws only. The previous
+/// evaluations are searched linearly for the closest one, and are discarded whenever the
+/// partition, the options or the source terms of the kinetic solver change.
+/// @see KineticSolver
+struct SmartKineticOptions
+{
+    /// The boolean flag that indicates if the smart evaluation of kinetic rates is used.
+    bool active = false;
+
+    /// The relative tolerance for the variation of ln activities of the species and amounts of kinetic species.
+    double reltol = 1e-3;
+
+    /// The absolute tolerance for the variation of ln activities of the species and amounts of kinetic species.
+    double abstol = 1e-8;
+
+    /// The maximum number of rate evaluations kept for the prediction of new ones.
+    /// The cost of searching for the closest evaluation grows linearly with this number.
+    unsigned max_records = 100;
+};
+
+/// The method used to calculate the Jacobian of the chemical kinetics equations.
+enum class KineticJacobian
+{
+    /// The Jacobian is calculated with the derivatives of the rates and the sensitivity of the equilibrium state.
+    Sensitivity,
+
+    /// The Jacobian is calculated with finite differences of the rates, with structurally
+    /// independent columns (e.g., kinetic minerals in different reactions) perturbed together.
+    FiniteDifference,
+};
+
+/// A struct to describe the options for the calculation of the Jacobian of the chemical kinetics equations.
+/// @see KineticSolver
+struct KineticJacobianOptions
+{
+    /// The method used to calculate the Jacobian.
+    KineticJacobian mode = KineticJacobian::Sensitivity;
+
+    /// The maximum number of Jacobian evaluations using the same sensitivity of the equilibrium state.
+    /// The sensitivity is recomputed once this age is reached or whenever the ODE solver requests a
+    /// Jacobian without advancing in time (i.e., after a convergence failure). The sensitivity is
+    /// recomputed in every Jacobian evaluation if its value is zero or one.
+    unsigned max_sensitivity_age = 0;
+
+    /// The relative perturbation of `u = [be nk]` used in the finite difference Jacobian.
+    double fdstep = 1e-8;
+
+    /// The boolean flag that indicates if independent Jacobian columns are perturbed together.
+    /// The columns of kinetic species are grouped using the sparsity of the stoichiometric matrix
+    /// and of the rate derivatives at the first finite difference Jacobian evaluation. Disable this
+    /// if some rates depend on species without reporting it in their derivatives (e.g., catalysts or
+    /// inhibitors in rates set with only their values), so that every column is perturbed separately.
+    bool coloring = true;
+};
+
+/// A struct to describe the options for advancing many chemical states with KineticSolver.
+/// @see KineticSolver::solve
+struct KineticBatchOptions
+{
+    /// The number of threads used to advance the chemical states.
+    /// The number of concurrent threads supported by the hardware is used if its value is zero.
+    unsigned num_threads = 0;
+
+    /// The factor that controls when a chemical state is considered to have negligible kinetic rates.
+    /// The integration of a chemical state from `t` to `t + dt` is skipped if the right-hand side
+    /// function `f` of the kinetic equations satisfies `dt*|f[i]| <= factor*(reltol*|u[i]| + abstol[i])`
+    /// for all components of `u = [be nk]`, where `reltol` and `abstol` are the tolerances in the
+    /// ODE options. Such chemical state is only brought to equilibrium at its current `be` and `nk`.
+    /// Set this factor to zero to integrate every chemical state.
+    double negligible_rates_factor = 1.0;
+};
+
 /// A struct to describe the options for a chemical kinetics calculation.
 /// @see KineticProblem, KineticSolver
 struct KineticOptions
@@ -42,6 +119,15 @@ struct KineticOptions
 
     /// The options for the output of the chemical kinetics calculation
     KineticOutputOptions output;
+
+    /// The options for the smart evaluation of kinetic rates.
+    SmartKineticOptions smart;
+
+    /// The options for the calculation of the Jacobian of the chemical kinetics equations.
+    KineticJacobianOptions jacobian;
+
+    /// The options for advancing many chemical states at once.
+    KineticBatchOptions batch;
 };
 
 } // namespace Reaktoro
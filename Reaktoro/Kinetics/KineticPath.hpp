@@ -35,6 +35,7 @@ class ReactionSystem;
 struct KineticOptions;
 
 /// A class that conveniently solves kinetic path calculations.
+/// The same restrictions of KineticSolver apply to the use of KineticPath instances in different threads.
 class KineticPath
 {
 public:
@@ -18,12 +18,19 @@
 #include "KineticSolver.hpp"
 
 // C++ includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <functional>
+#include <limits>
+#include <list>
+#include <thread>
 using namespace std::placeholders;
 
 // Reaktoro includes
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
@@ -44,6 +51,19 @@ namespace Reaktoro {
 
 struct KineticSolver::Impl
 {
+    /// A previous evaluation of the kinetic rates used in their smart evaluation
+    struct RatesRecord
+    {
+        /// The temperature and pressure of the evaluation (in units of K and Pa)
+        double T, P;
+
+        /// The molar amounts and ln activities of the species in the evaluation
+        Vector n, lna;
+
+        /// The kinetic rates of the reactions and their partial derivatives
+        ChemicalVector r;
+    };
+
     /// The kinetically-controlled chemical reactions
     ReactionSystem reactions;
 
@@ -128,11 +148,45 @@ struct KineticSolver::Impl
     /// The function that calculates the source term in the problem
     std::function<ChemicalVector(const ChemicalProperties&)> source_fn;
 
+    /// The right-hand side function of the kinetic equations at the start of a time step
+    Vector f;
+
+    /// The kinetic solvers used by each thread to advance many chemical states
+    std::vector<std::unique_ptr<Impl>> workers;
+
+    /// The number of Jacobian evaluations that used the current sensitivity of the equilibrium state
+    unsigned sensitivity_age = 0;
+
+    /// The time of the last Jacobian evaluation
+    double jacobian_time = 0.0;
+
+    /// The previous evaluations of the kinetic rates used for their smart evaluation
+    std::list<RatesRecord> records;
+
+    /// The previous evaluation of the kinetic rates used in the last smart evaluation
+    std::list<RatesRecord>::iterator record;
+
+    /// The groups of Jacobian columns that are perturbed together in the finite difference Jacobian
+    std::vector<Indices> column_groups;
+
+    /// The indices of the rows that can be non-zero in each Jacobian column
+    std::vector<Indices> column_rows;
+
+    /// The perturbed vector `u = [be nk]` and the corresponding right-hand side functions used in the finite difference Jacobian
+    Vector up, f0, fp;
+
+    /// The chemical state perturbed in the finite difference Jacobian, keeping the unperturbed one intact
+    ChemicalState fdstate;
+
+    /// The chemical properties, reaction rates and source rates at the unperturbed `u = [be nk]`
+    ChemicalProperties properties0;
+    ChemicalVector r0, q0;
+
     Impl()
     {}
 
     Impl(const ReactionSystem& reactions)
-    : reactions(reactions), system(reactions.system()), equilibrium(system)
+    : reactions(reactions), system(reactions.system()), equilibrium(system), properties(system)
     {
         setPartition(Partition(system));
     }
@@ -141,6 +195,13 @@ struct KineticSolver::Impl
     {
         // Initialise the options of the kinetic solver
         options = options_;
+
+        // Ensure the kinetic solvers of the threads are recreated with the new options
+        workers.clear();
+
+        // Ensure the Jacobian column groups and the smart rate evaluations are redone with the new options
+        column_groups.clear();
+        records.clear();
     }
 
     auto setPartition(const Partition& partition_) -> void
@@ -148,6 +209,11 @@ struct KineticSolver::Impl
         // Initialise the partition member
         partition = partition_;
 
+        // Ensure the kinetic solvers of the threads are recreated with the new partition
+        workers.clear();
+        column_groups.clear();
+        records.clear();
+
         // Set the partition of the equilibrium solver
         equilibrium.setPartition(partition);
 
@@ -200,6 +266,9 @@ struct KineticSolver::Impl
 
     auto addSource(ChemicalState state, double volumerate, std::string units) -> void
     {
+        workers.clear();
+        column_groups.clear();
+        records.clear();
         const Index num_species = system.numSpecies();
         const double volume = units::convert(volumerate, units, "m3/s");
         state.scaleVolume(volume);
@@ -216,10 +285,15 @@ struct KineticSolver::Impl
         };
     }
 
-    auto addPhaseSink(std::string phase, double volumerate, std::string units) -> void
+    auto addPhaseSink(Index iphase, double volumerate, std::string units) -> void
     {
+        Assert(iphase < system.numPhases(),
+            "Could not add a phase sink with phase index `" + std::to_string(iphase) + "`.",
+            "The phase index must be less than the number of phases `" + std::to_string(system.numPhases()) + "`.");
+        workers.clear();
+        column_groups.clear();
+        records.clear();
         const double volume = units::convert(volumerate, units, "m3/s");
-        const Index iphase = system.indexPhaseWithError(phase);
         const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
         const Index size = system.numSpeciesInPhase(iphase);
         auto old_source_fn = source_fn;
@@ -241,6 +315,9 @@ struct KineticSolver::Impl
 
     auto addFluidSink(double volumerate, std::string units) -> void
     {
+        workers.clear();
+        column_groups.clear();
+        records.clear();
         const double volume = units::convert(volumerate, units, "m3/s");
         const Indices& isolid_species = partition.indicesSolidSpecies();
         auto old_source_fn = source_fn;
@@ -261,6 +338,9 @@ struct KineticSolver::Impl
 
     auto addSolidSink(double volumerate, std::string units) -> void
     {
+        workers.clear();
+        column_groups.clear();
+        records.clear();
         const double volume = units::convert(volumerate, units, "m3/s");
         const Indices& ifluid_species = partition.indicesFluidSpecies();
         auto old_source_fn = source_fn;
@@ -285,6 +365,10 @@ struct KineticSolver::Impl
         T = state.temperature();
         P = state.pressure();
 
+        // Ensure the sensitivity of the equilibrium state is computed in the first Jacobian evaluation
+        sensitivity_age = 0;
+        jacobian_time = -std::numeric_limits<double>::infinity();
+
         // Extract the composition of the equilibrium and kinetic species
         const auto& n = state.speciesAmounts();
         ne = n(ies);
@@ -364,6 +448,137 @@ struct KineticSolver::Impl
         // Initialise the chemical kinetics solver
         initialize(state, t);
 
+        // Integrate the chemical kinetics problem from `t` to `t + dt`
+        integrate(state, t, dt);
+    }
+
+    auto numThreads(Index num_states) const -> Index
+    {
+        // The chemical states are advanced in the calling thread only if the chemical system cannot be cloned
+        if(!system.cloneable())
+            return 1;
+
+        Index num_threads = options.batch.num_threads;
+        if(num_threads == 0)
+            num_threads = std::thread::hardware_concurrency();
+        return std::max<Index>(1, std::min(num_threads, num_states));
+    }
+
+    auto solve(std::vector<ChemicalState>& states, double t, double dt, const KineticBatchFunction& fn) -> Index
+    {
+        // The number of chemical states to be advanced
+        const Index num_states = states.size();
+
+        if(num_states == 0)
+            return 0;
+
+        // The number of threads used to advance the chemical states
+        const Index num_threads = numThreads(num_states);
+
+        // Create the kinetic solvers of the threads not yet created
+        initializeWorkers(num_threads);
+
+        // The index of the next chemical state to be advanced by any thread
+        std::atomic<Index> next(0);
+
+        // The number of chemical states that were integrated (i.e., not skipped)
+        std::atomic<Index> num_integrated(0);
+
+        // The exceptions thrown in each thread, to be rethrown in the calling thread
+        std::vector<std::exception_ptr> errors(num_threads);
+
+        // The work of each thread, which advances one chemical state at a time until none remains
+        auto work = [&](Index ithread)
+        {
+            Impl& worker = *workers[ithread];
+            try
+            {
+                for(Index i = next++; i < num_states; i = next++)
+                {
+                    if(worker.advance(states[i], t, dt))
+                        ++num_integrated;
+                    if(fn)
+                        fn(ithread, i, worker.equilibrium.properties(), worker.equilibrium.sensitivity());
+                }
+            }
+            catch(...)
+            {
+                errors[ithread] = std::current_exception();
+                next = num_states;
+            }
+        };
+
+        // Start the additional threads and use the calling thread as the first one
+        std::vector<std::thread> threads;
+        for(Index ithread = 1; ithread < num_threads; ++ithread)
+            threads.emplace_back(work, ithread);
+        work(0);
+
+        for(std::thread& thread : threads)
+            thread.join();
+
+        for(const std::exception_ptr& error : errors)
+            if(error) std::rethrow_exception(error);
+
+        return num_integrated;
+    }
+
+    /// Create the kinetic solvers used by each thread to advance many chemical states.
+    auto initializeWorkers(Index num_workers) -> void
+    {
+        while(workers.size() < num_workers)
+        {
+            // Each worker owns a deep copy of the chemical system so that its models are not evaluated concurrently
+            const ChemicalSystem worker_system = system.cloneable() ? system.clone() : system;
+
+            std::unique_ptr<Impl> worker(new Impl(ReactionSystem(worker_system, reactions.reactions())));
+            worker->setOptions(options);
+            worker->setPartition(partition);
+            worker->source_fn = source_fn;
+
+            workers.push_back(std::move(worker));
+        }
+    }
+
+    /// Advance a chemical state from `t` to `t + dt`, unless its kinetic rates are negligible.
+    /// @return True if the chemical state was integrated, false if it was only equilibrated.
+    auto advance(ChemicalState& state, double t, double dt) -> bool
+    {
+        // Initialise the chemical kinetics solver
+        initialize(state, t);
+
+        // Evaluate the right-hand side function at the start of the step (this also equilibrates the state)
+        f.resize(Ee + Nk);
+        if(function(state, t, benk, f) == 0 && negligible(dt))
+            return false;
+
+        // Integrate the chemical kinetics problem from `t` to `t + dt`
+        integrate(state, t, dt);
+
+        return true;
+    }
+
+    /// Return true if the change in `u = [be nk]` over a time step is below the tolerances of the ODE solver.
+    auto negligible(double dt) const -> bool
+    {
+        const double factor = options.batch.negligible_rates_factor;
+        const double reltol = options.ode.reltol;
+        const Vector& abstols = options.ode.abstols;
+        const bool componentwise = abstols.size() == benk.size();
+
+        for(Index i = 0; i < Ee + Nk; ++i)
+        {
+            const double abstol = componentwise ? abstols[i] : options.ode.abstol;
+            if(dt * std::abs(f[i]) > factor * (reltol * std::abs(benk[i]) + abstol))
+                return false;
+        }
+
+        return true;
+    }
+
+    /// Integrate the chemical kinetics problem from `t` to `t + dt` with an initialized ODE solver.
+    auto integrate(ChemicalState& state, double t, double dt) -> void
+    {
         // Integrate the chemical kinetics ODE from `t` to `t + dt`
         ode.solve(t, dt, benk);
 
@@ -408,10 +623,10 @@ struct KineticSolver::Impl
             "The equilibrium calculation failed.");
 
         // Update the chemical properties of the system
-        properties = state.properties();
+        properties.update(T, P, state.speciesAmounts());
 
         // Calculate the kinetic rates of the reactions
-        r = reactions.rates(properties);
+        rates();
 
         // Calculate the right-hand side function of the ODE
         res = A * r.val;
@@ -429,10 +644,82 @@ struct KineticSolver::Impl
         return 0;
     }
 
+    /// Calculate the kinetic rates of the reactions, predicting them from a previous evaluation if possible.
+    auto rates() -> void
+    {
+        // Evaluate the rates of the reactions if smart evaluation is not active
+        if(!options.smart.active)
+        {
+            r = reactions.rates(properties);
+            return;
+        }
+
+        const auto& reltol = options.smart.reltol;
+        const auto& abstol = options.smart.abstol;
+        const auto& n = properties.composition().val;
+        const auto& lna = properties.lnActivities().val;
+
+        // Check if the rates can be predicted from a previous evaluation within the tolerances
+        auto acceptable = [&](const RatesRecord& rec)
+        {
+            if(rec.T != T || rec.P != P)
+                return false;
+            if(((lna - rec.lna).array().abs() > abstol + reltol * rec.lna.array().abs()).any())
+                return false;
+            for(Index i : iks)
+                if(std::abs(n[i] - rec.n[i]) > abstol + reltol * std::abs(rec.n[i]))
+                    return false;
+            return true;
+        };
+
+        // Try the evaluation used last time, then the one closest to the current composition
+        if(records.empty() || !acceptable(*record))
+        {
+            auto distance = [&](const RatesRecord& a, const RatesRecord& b)
+            {
+                return (a.n - n).squaredNorm() < (b.n - n).squaredNorm();
+            };
+
+            record = std::min_element(records.begin(), records.end(), distance);
+
+            // Evaluate the rates of the reactions if none of the previous evaluations can be used
+            if(record == records.end() || !acceptable(*record))
+            {
+                if(!records.empty() && records.size() >= options.smart.max_records)
+                    records.pop_front();
+                records.push_back({T, P, n, lna, reactions.rates(properties)});
+                record = std::prev(records.end());
+                r = record->r;
+                return;
+            }
+        }
+
+        // Predict the rates with a first-order Taylor expansion around the previous evaluation
+        r = record->r;
+        r.val.noalias() += record->r.ddn * (n - record->n);
+    }
+
     auto jacobian(ChemicalState& state, double t, VectorConstRef u, MatrixRef res) -> int
     {
-        // Calculate the sensitivity of the equilibrium state
-        sensitivity = equilibrium.sensitivity();
+        // A Jacobian requested without advancing in time indicates a convergence failure in the ODE solver
+        const bool failure = t <= jacobian_time;
+
+        // Update the time of the last Jacobian evaluation
+        jacobian_time = t;
+
+        // Calculate the Jacobian matrix with finite differences if requested
+        if(options.jacobian.mode == KineticJacobian::FiniteDifference)
+            return jacobianFiniteDifference(state, t, u, res);
+
+        // Calculate the sensitivity of the equilibrium state, unless the current one can be reused
+        if(sensitivity_age == 0 || sensitivity_age >= options.jacobian.max_sensitivity_age || failure)
+        {
+            sensitivity = equilibrium.sensitivity();
+            sensitivity_age = 0;
+        }
+
+        // Update the number of Jacobian evaluations that used the current sensitivity
+        ++sensitivity_age;
 
         // Extract the columns of the kinetic rates derivatives w.r.t. the equilibrium and kinetic species
         drdne = cols(r.ddn, ies);
@@ -466,6 +753,128 @@ struct KineticSolver::Impl
 
         return 0;
     }
+
+    auto jacobianFiniteDifference(ChemicalState& state, double t, VectorConstRef u, MatrixRef res) -> int
+    {
+        // Evaluate the right-hand side function at the unperturbed `u`
+        f0.resize(u.size());
+        if(int error = function(state, t, u, f0))
+            return error;
+
+        // Determine the groups of Jacobian columns that can be perturbed together
+        if(column_groups.empty())
+            initializeColumnGroups();
+
+        // Save the properties and rates at `u`, since the perturbations below overwrite them
+        properties0 = properties;
+        r0 = r;
+        q0 = q;
+
+        // Perturb a copy of the chemical state so that `state` remains the one at `u`
+        fdstate = state;
+
+        res.fill(0.0);
+
+        // Perturb all columns in a group at once, since they do not affect the same rows
+        int error = 0;
+        for(const Indices& group : column_groups)
+        {
+            up = u;
+            for(Index j : group)
+                up[j] += fdstep(u[j]);
+
+            fp.resize(u.size());
+            if((error = function(fdstate, t, up, fp)))
+                break;
+
+            for(Index j : group)
+            {
+                const double h = up[j] - u[j];
+                for(Index i : column_rows[j])
+                    res(i, j) = (fp[i] - f0[i])/h;
+            }
+        }
+
+        // Restore the properties and rates at the unperturbed `u`
+        properties = properties0;
+        r = r0;
+        q = q0;
+
+        return error;
+    }
+
+    /// Return the perturbation of a component of `u = [be nk]` for the finite difference Jacobian.
+    auto fdstep(double uj) const -> double
+    {
+        return options.jacobian.fdstep * std::max(std::abs(uj), options.ode.abstol);
+    }
+
+    /// Determine the structurally independent groups of Jacobian columns for the finite difference Jacobian.
+    /// A column of a kinetic species affects only the rows of the reactions in which the species participates
+    /// or whose rates depend on it, as probed from the derivatives of the rates `r` at their last evaluation,
+    /// provided it does not belong to a phase with equilibrium species, and there are no source terms. All other
+    /// columns (e.g., of the elements in the equilibrium partition) can affect every row of the Jacobian.
+    auto initializeColumnGroups() -> void
+    {
+        const Index num_rows = Ee + Nk;
+        const Index num_reactions = reactions.numReactions();
+
+        // All rows of the Jacobian
+        Indices all(num_rows);
+        for(Index i = 0; i < num_rows; ++i)
+            all[i] = i;
+
+        // Initialise the non-zero rows of every column as all rows
+        column_rows.assign(num_rows, all);
+
+        // Determine the non-zero rows of the columns of the kinetic species
+        if(!source_fn && options.jacobian.coloring)
+        {
+            for(Index k = 0; k < Nk; ++k)
+            {
+                // Check if the kinetic species shares its phase with equilibrium species
+                const Index iphase = system.indexPhaseWithSpecies(iks[k]);
+                const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
+                const Index size = system.numSpeciesInPhase(iphase);
+
+                bool coupled = false;
+                for(Index i = ifirst; i < ifirst + size && !coupled; ++i)
+                    coupled = std::find(ies.begin(), ies.end(), i) != ies.end();
+
+                if(coupled)
+                    continue;
+
+                // Collect the rows of the coefficient matrix `A` of the reactions with or depending on this kinetic species
+                Indices rows;
+                for(Index m = 0; m < num_reactions; ++m)
+                    if(Sk(m, k) != 0.0 || r.ddn(m, iks[k]) != 0.0)
+                        for(Index i = 0; i < num_rows; ++i)
+                            if(A(i, m) != 0.0 && std::find(rows.begin(), rows.end(), i) == rows.end())
+                                rows.push_back(i);
+
+                column_rows[Ee + k] = rows;
+            }
+        }
+
+        // Group the columns greedily so that no two columns in a group share a non-zero row
+        column_groups.clear();
+        std::vector<Indices> group_rows;
+        for(Index j = 0; j < num_rows; ++j)
+        {
+            Index igroup = 0;
+            while(igroup < column_groups.size() && !emptyIntersection(group_rows[igroup], column_rows[j]))
+                ++igroup;
+
+            if(igroup == column_groups.size())
+            {
+                column_groups.emplace_back();
+                group_rows.emplace_back();
+            }
+
+            column_groups[igroup].push_back(j);
+            group_rows[igroup].insert(group_rows[igroup].end(), column_rows[j].begin(), column_rows[j].end());
+        }
+    }
 };
 
 KineticSolver::KineticSolver()
@@ -490,6 +899,11 @@ auto KineticSolver::setOptions(const KineticOptions& options) -> void
     pimpl->setOptions(options);
 }
 
+auto KineticSolver::options() const -> const KineticOptions&
+{
+    return pimpl->options;
+}
+
 auto KineticSolver::setPartition(const Partition& partition) -> void
 {
     pimpl->setPartition(partition);
@@ -502,7 +916,12 @@ auto KineticSolver::addSource(const ChemicalState& state, double volumerate, std
 
 auto KineticSolver::addPhaseSink(std::string phase, double volumerate, std::string units) -> void
 {
-    pimpl->addPhaseSink(phase, volumerate, units);
+    pimpl->addPhaseSink(pimpl->system.indexPhaseWithError(phase), volumerate, units);
+}
+
+auto KineticSolver::addPhaseSink(Index iphase, double volumerate, std::string units) -> void
+{
+    pimpl->addPhaseSink(iphase, volumerate, units);
 }
 
 auto KineticSolver::addFluidSink(double volumerate, std::string units) -> void
@@ -535,4 +954,19 @@ auto KineticSolver::solve(ChemicalState& state, double t, double dt) -> void
     pimpl->solve(state, t, dt);
 }
 
+auto KineticSolver::solve(std::vector<ChemicalState>& states, double t, double dt) -> Index
+{
+    return pimpl->solve(states, t, dt, KineticBatchFunction());
+}
+
+auto KineticSolver::solve(std::vector<ChemicalState>& states, double t, double dt, const KineticBatchFunction& fn) -> Index
+{
+    return pimpl->solve(states, t, dt, fn);
+}
+
+auto KineticSolver::numThreads(Index num_states) const -> Index
+{
+    return pimpl->numThreads(num_states);
+}
+
 } // namespace Reaktoro
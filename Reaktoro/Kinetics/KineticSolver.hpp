@@ -18,19 +18,35 @@
 #pragma once
 
 // C++ includes
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
 
 namespace Reaktoro {
 
 // Forward declarations
-class ChemicalState;
+class ChemicalProperties;
 class ChemicalState;
 class Partition;
 class ReactionSystem;
+struct EquilibriumSensitivity;
 struct KineticOptions;
 
+/// The signature of a function called after each chemical state is advanced by @ref KineticSolver::solve.
+/// The function is called in the thread that advanced the chemical state, with the index of this thread,
+/// the index of the chemical state, and the chemical properties and equilibrium sensitivity of the last
+/// equilibrium calculation of the chemical state.
+using KineticBatchFunction = std::function<void(Index, Index, const ChemicalProperties&, const EquilibriumSensitivity&)>;
+
 /// A class that represents a solver for chemical kinetics problems.
+/// A KineticSolver instance cannot be used concurrently in different threads, although its method
+/// @ref solve advances many chemical states in threads of its own. KineticSolver instances used
+/// concurrently must be constructed with reaction systems whose chemical systems are different
+/// clones (e.g., `ReactionSystem(system.clone(), reactions.reactions())`, see ChemicalSystem::clone).
 /// @see KineticProblem
 class KineticSolver
 {
@@ -53,6 +69,9 @@ public:
     /// Set the options for the chemical kinetics calculation.
     auto setOptions(const KineticOptions& options) -> void;
 
+    /// Return the options for the chemical kinetics calculation.
+    auto options() const -> const KineticOptions&;
+
     /// Set the partition of the chemical system.
     /// Use this method to specify the equilibrium, kinetic, and inert species.
     auto setPartition(const Partition& partition) -> void;
@@ -71,6 +90,12 @@ public:
     /// @param units The units of the volumetric rate (compatible with m3/s).
     auto addPhaseSink(std::string phase, double volumerate, std::string units) -> void;
 
+    /// Add a phase sink to the chemical kinetics problem.
+    /// @param iphase The index of the phase.
+    /// @param volumerate The volumetric rate of the phase removal.
+    /// @param units The units of the volumetric rate (compatible with m3/s).
+    auto addPhaseSink(Index iphase, double volumerate, std::string units) -> void;
+
     /// Add a fluid sink to the chemical kinetics problem.
     /// This method allows the chemical kinetics problem to account for
     /// the sink (i.e., the removal) of fluid from the system.
@@ -110,6 +135,32 @@ public:
     /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
     auto solve(ChemicalState& state, double t, double dt) -> void;
 
+    /// Solve the chemical kinetics problem of many chemical states from a given initial time to a final time.
+    /// The chemical states are advanced concurrently, with each thread using its own ODE and equilibrium solvers,
+    /// and each chemical state is integrated with its own adaptive time stepping. The chemical states whose
+    /// kinetic rates are negligible over the time step are only equilibrated (see @ref KineticBatchOptions).
+    /// The chemical states are advanced in the calling thread only if the chemical system is not cloneable
+    /// (see @ref ChemicalSystem::cloneable).
+    /// @param states The kinetic states of the system (e.g., one for each cell in a mesh)
+    /// @param t The start time of the integration (in units of seconds)
+    /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
+    /// @return The number of chemical states that were integrated (i.e., not skipped).
+    auto solve(std::vector<ChemicalState>& states, double t, double dt) -> Index;
+
+    /// Solve the chemical kinetics problem of many chemical states from a given initial time to a final time.
+    /// This method is identical to the one above, but it also calls a function after each chemical state is
+    /// advanced, so that quantities depending on the chemical properties and equilibrium sensitivity of the
+    /// final chemical states can be computed without equilibrating them once more.
+    /// @param states The kinetic states of the system (e.g., one for each cell in a mesh)
+    /// @param t The start time of the integration (in units of seconds)
+    /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
+    /// @param fn The function called after each chemical state is advanced
+    /// @return The number of chemical states that were integrated (i.e., not skipped).
+    auto solve(std::vector<ChemicalState>& states, double t, double dt, const KineticBatchFunction& fn) -> Index;
+
+    /// Return the number of threads used by @ref solve to advance a given number of chemical states.
+    auto numThreads(Index num_states) const -> Index;
+
 private:
     struct Impl;
 
@@ -19,6 +19,7 @@
 
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Math/Derivatives.hpp>
+#include <Reaktoro/Math/DiagonalLowRankMatrix.hpp>
 #include <Reaktoro/Math/LagrangeInterpolator.hpp>
 #include <Reaktoro/Math/LU.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
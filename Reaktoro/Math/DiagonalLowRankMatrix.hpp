@@ -0,0 +1,40 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// A type to represent a square matrix as a diagonal matrix plus a low-rank matrix, `diag(D) + U*tr(V)`.
+/// The number of columns of `U` and `V` is expected to be much smaller than their number of rows,
+/// so that linear systems with this matrix can be solved at nearly the cost of diagonal ones.
+struct DiagonalLowRankMatrix
+{
+    /// The diagonal entries `D` of the matrix.
+    Vector D;
+
+    /// The left factor `U` of the low-rank part of the matrix.
+    Matrix U;
+
+    /// The right factor `V` of the low-rank part of the matrix.
+    Matrix V;
+};
+
+} // namespace Reaktoro
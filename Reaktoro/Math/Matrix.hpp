@@ -87,6 +87,10 @@ using MatrixConstMap = Eigen::Map<const MatrixXd>; ///< Alias to Eigen type Eige
 using MatrixXdConstMap = Eigen::Map<const MatrixXd>; ///< Alias to Eigen type Eigen::Map<const MatrixXd>.
 using MatrixXiConstMap = Eigen::Map<const MatrixXi>; ///< Alias to Eigen type Eigen::Map<const MatrixXi>.
 
+using MatrixRowMajor = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>; ///< Alias to a row-major Eigen matrix type.
+using MatrixRowMajorRef = Eigen::Ref<MatrixRowMajor>; ///< Alias to Eigen type Eigen::Ref<MatrixRowMajor>.
+using MatrixRowMajorConstRef = Eigen::Ref<const MatrixRowMajor>; ///< Alias to Eigen type Eigen::Ref<const MatrixRowMajor>.
+
 /// Define an alias to a permutation matrix type of the Eigen library
 using PermutationMatrix = Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic>;
 
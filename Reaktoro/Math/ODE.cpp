@@ -17,6 +17,13 @@
 
 #include "ODE.hpp"
 
+// C++ includes
+#include <cmath>
+#include <limits>
+
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/LU>
+
 // Sundials includes
 #include <cvode/cvode.h>
 #include <cvode/cvode_dense.h>
@@ -74,6 +81,330 @@ struct ODEProblem::Impl
     ODEJacobian ode_jacobian;
 };
 
+/// The native Rosenbrock method used in ODESolver.
+/// This is the second-order Rosenbrock method of Shampine and Reichelt (1997) with an embedded
+/// third-order error estimate and a continuous extension for dense output. Since the method
+/// is of W-type, its order does not depend on the exactness of the Jacobian, which is then
+/// reused across steps (and across calls to solve) together with the LU factorization of
+/// the iteration matrix. The Jacobian is only re-evaluated after a step rejection, after
+/// `max_jacobian_age` steps, or after the problem is set or the solver initialized again. All memory is allocated once, in the first initialization.
+struct ODESolverRosenbrock
+{
+    /// The ODE problem
+    const ODEProblem& problem;
+
+    /// The options for the ODE integration
+    const ODEOptions& options;
+
+    /// The number of equations
+    Index n = 0;
+
+    /// The current time and its variables
+    double t = 0.0;
+    Vector y;
+
+    /// The time and variables at the beginning of the last integration step
+    double told = 0.0;
+    Vector yold;
+
+    /// The current step size and the size of the last integration step
+    double h = 0.0, hold = 0.0;
+
+    /// The step size used in the current LU factorization of the iteration matrix (zero if none)
+    double hlu = 0.0;
+
+    /// The number of steps the current Jacobian has been used in
+    unsigned jacobian_age = 0;
+
+    /// The boolean flag that indicates if F0 is the function evaluated at the current time and variables
+    bool current = false;
+
+    /// The boolean flag that indicates if the last function evaluation happened at the current time and variables,
+    /// which is needed by Jacobian functions that reuse data of the last function evaluation
+    bool evaluated = false;
+
+    /// The function evaluations in a step, the time derivative of the function and the stages
+    Vector F0, F1, F2, T, k1, k2, k3, kk1, kk2;
+
+    /// The auxiliary vectors for the new variables, the error estimate and the right-hand sides
+    Vector ynew, err, rhs;
+
+    /// The Jacobian matrix and the iteration matrix W = I - h*d*J
+    Matrix J, W;
+
+    /// The LU factorization of the iteration matrix
+    Eigen::PartialPivLU<Matrix> lu;
+
+    /// Construct a ODESolverRosenbrock instance with given problem and options
+    ODESolverRosenbrock(const ODEProblem& problem, const ODEOptions& options)
+    : problem(problem), options(options)
+    {}
+
+    /// Return the coefficient d = 1/(2 + sqrt(2)) of the method.
+    static auto coeffd() -> double { return 1.0/(2.0 + std::sqrt(2.0)); }
+
+    /// Return the absolute tolerance of the i-th variable
+    auto abstol(Index i) const -> double
+    {
+        return Index(options.abstols.size()) == n ? options.abstols[i] : options.abstol;
+    }
+
+    /// Evaluate the right-hand side function and return false if a recoverable failure happened.
+    auto function(double tt, VectorConstRef yy, VectorRef ff) -> bool
+    {
+        const int res = problem.function(tt, yy, ff);
+        evaluated = false;
+        Assert(res >= 0,
+            "Cannot proceed with ODESolver::integrate to integrate the differential equations.",
+            "There was an unrecoverable failure in the evaluation of the right-hand side function.");
+        return res == 0;
+    }
+
+    /// Initialize the integration, keeping the Jacobian, LU factorization and step size of previous calls.
+    auto initialize(double tstart, VectorConstRef y0) -> void
+    {
+        // Allocate memory only if the number of equations has changed
+        if(n != Index(y0.size()))
+        {
+            n = y0.size();
+            for(Vector* v : {&y, &yold, &F0, &F1, &F2, &T, &k1, &k2, &k3, &kk1, &kk2, &ynew, &err, &rhs})
+                v->resize(n);
+            J.resize(n, n);
+            W.resize(n, n);
+            h = hlu = 0.0;
+            jacobian_age = std::numeric_limits<unsigned>::max();
+        }
+
+        t = told = tstart;
+        y = yold = y0;
+        hold = 0.0;
+        current = evaluated = false;
+
+        if(options.initial_step)
+            h = options.initial_step;
+    }
+
+    /// Ensure the Jacobian is re-evaluated in the next step, e.g., after the ODE problem has changed.
+    auto reset() -> void
+    {
+        jacobian_age = std::numeric_limits<unsigned>::max();
+        hlu = 0.0;
+    }
+
+    /// Update the Jacobian matrix and the time derivative of the function at the current time and variables.
+    auto updateJacobian() -> void
+    {
+        // Ensure the last evaluation of the function happened at the current state
+        if(!current || (problem.jacobian() && !evaluated))
+        {
+            Assert(function(t, y, F0),
+                "Cannot proceed with ODESolver::integrate to integrate the differential equations.",
+                "There was a failure in the evaluation of the right-hand side function.");
+            current = evaluated = true;
+        }
+
+        const double sqrteps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+        // Calculate the Jacobian matrix, using finite differences if no Jacobian function was given
+        if(problem.jacobian())
+        {
+            Assert(problem.jacobian(t, y, J) == 0,
+                "Cannot proceed with ODESolver::integrate to integrate the differential equations.",
+                "There was a failure in the evaluation of the Jacobian function.");
+        }
+        else
+        {
+            for(Index j = 0; j < n; ++j)
+            {
+                const double yj = y[j];
+                const double delta = sqrteps * std::max(std::abs(yj), abstol(j));
+                y[j] = yj + delta;
+                function(t, y, F1);
+                y[j] = yj;
+                J.col(j) = (F1 - F0)/delta;
+            }
+        }
+
+        // Calculate the derivative of the function with respect to time
+        const double delta = sqrteps * std::max(std::max(std::abs(t), std::abs(h)), sqrteps);
+        function(t + delta, y, F1);
+        T = (F1 - F0)/delta;
+
+        jacobian_age = 0;
+        hlu = 0.0;
+    }
+
+    /// Return an initial step size based on the magnitude of the function at the current state.
+    auto initialStep(double tfinal) const -> double
+    {
+        double rh = 0.0;
+        for(Index i = 0; i < n; ++i)
+            rh = std::max(rh, std::abs(F0[i])/std::max(std::abs(y[i]), abstol(i)/options.reltol));
+        rh *= 1.25/std::cbrt(options.reltol);
+        return rh > 0.0 ? 1.0/rh : std::isfinite(tfinal) ? tfinal - t : 1.0;
+    }
+
+    /// Perform one integration step not going over a given time.
+    auto step(double tfinal) -> void
+    {
+        const double d = coeffd();
+        const double e32 = 6.0 + std::sqrt(2.0);
+
+        if(options.stop_time)
+            tfinal = std::min(tfinal, options.stop_time);
+
+        // Evaluate the function at the current state if the last step has not done so
+        if(!current)
+        {
+            Assert(function(t, y, F0),
+                "Cannot proceed with ODESolver::integrate to integrate the differential equations.",
+                "There was a failure in the evaluation of the right-hand side function.");
+            current = evaluated = true;
+        }
+
+        if(h == 0.0)
+            h = initialStep(tfinal);
+
+        for(unsigned failures = 0; failures <= options.max_num_error_test_failures; ++failures)
+        {
+            // Bound the step size by the given options and the final time
+            if(options.max_step) h = std::min(h, options.max_step);
+            if(options.min_step) h = std::max(h, options.min_step);
+            const bool clamped = t + h >= tfinal;
+            const double hstep = clamped ? tfinal - t : h;
+
+            Assert(t + hstep > t,
+                "Cannot proceed with ODESolver::integrate to integrate the differential equations.",
+                "The step size became too small compared to the current time.");
+
+            // Update the Jacobian if too old, and the LU factorization of W if the step size has changed
+            if(jacobian_age >= options.max_jacobian_age)
+                updateJacobian();
+
+            if(hlu != hstep)
+            {
+                W.noalias() = -hstep*d*J;
+                W.diagonal().array() += 1.0;
+                lu.compute(W);
+                hlu = hstep;
+            }
+
+            // Calculate the stages of the method
+            rhs.noalias() = F0 + hstep*d*T;
+            k1.noalias() = lu.solve(rhs);
+
+            ynew.noalias() = y + 0.5*hstep*k1;
+            bool success = function(t + 0.5*hstep, ynew, F1);
+
+            if(success)
+            {
+                rhs.noalias() = F1 - k1;
+                k2.noalias() = lu.solve(rhs);
+                k2 += k1;
+
+                ynew.noalias() = y + hstep*k2;
+                success = function(t + hstep, ynew, F2);
+            }
+
+            // Calculate the error estimate of the step
+            double errnorm = std::numeric_limits<double>::infinity();
+
+            if(success)
+            {
+                rhs.noalias() = F2 - e32*(k2 - F1) - 2.0*(k1 - F0) + hstep*d*T;
+                k3.noalias() = lu.solve(rhs);
+
+                err.noalias() = hstep/6.0 * (k1 - 2.0*k2 + k3);
+
+                errnorm = 0.0;
+                for(Index i = 0; i < n; ++i)
+                    errnorm = std::max(errnorm, std::abs(err[i]) /
+                        (abstol(i) + options.reltol * std::max(std::abs(y[i]), std::abs(ynew[i]))));
+            }
+
+            // The factor by which the step size is changed
+            const double factor = std::isfinite(errnorm) ?
+                0.8 * std::pow(std::max(errnorm, 1e-10), -1.0/3.0) : 0.25;
+
+            if(errnorm <= 1.0)
+            {
+                // Accept the step and keep its stages for dense output
+                told = t;
+                yold = y;
+                hold = hstep;
+                kk1 = k1;
+                kk2 = k2;
+
+                t = clamped ? tfinal : t + hstep;
+                y = ynew;
+                F0 = F2;
+                current = evaluated = true;
+
+                ++jacobian_age;
+
+                // Change the step size only if this cannot reuse the current LU factorization
+                if(factor < 1.0 || factor > 1.2)
+                    h = clamped ? std::min(h, hstep * factor) : hstep * std::min(factor, 5.0);
+
+                return;
+            }
+
+            // Reject the step, reduce the step size, and ensure an up-to-date Jacobian is used
+            h = hstep * std::max(factor, 0.1);
+
+            if(jacobian_age > 0)
+                updateJacobian();
+        }
+
+        RuntimeError("Cannot proceed with ODESolver::integrate to integrate the differential equations.",
+            "The maximum number of error test failures was reached.");
+    }
+
+    /// Integrate the ODE performing a single step.
+    auto integrate(double& tt, VectorRef yy) -> void
+    {
+        step(std::numeric_limits<double>::infinity());
+        tt = t;
+        yy = y;
+    }
+
+    /// Integrate the ODE performing a single step not going over a given time.
+    auto integrate(double& tt, VectorRef yy, double tfinal) -> void
+    {
+        step(tfinal);
+        tt = t;
+        yy = y;
+    }
+
+    /// Solve the ODE equations from a given start time to a final one.
+    auto solve(double& tt, double dt, VectorRef yy) -> void
+    {
+        const double tfinal = tt + dt;
+
+        initialize(tt, yy);
+
+        for(unsigned i = 0; t < tfinal; ++i)
+        {
+            Assert(i < options.max_num_steps,
+                "Cannot proceed with ODESolver::solve to integrate the differential equations.",
+                "The maximum number of steps was reached before the final time.");
+            step(tfinal);
+        }
+
+        tt = t;
+        yy = y;
+    }
+
+    /// Calculate the variables at a given time within the last integration step.
+    auto interpolate(double tt, VectorRef yy) const -> void
+    {
+        if(hold == 0.0) { yy = y; return; }
+        const double d = coeffd();
+        const double s = (tt - told)/hold;
+        yy = yold + hold/(1.0 - 2.0*d) * (s*(1.0 - s)*kk1 + s*(s - 2.0*d)*kk2);
+    }
+};
+
 struct ODESolver::Impl
 {
     /// The ODE problem
@@ -82,6 +413,9 @@ struct ODESolver::Impl
     /// The options for the ODE integration
     ODEOptions options;
 
+    /// The native Rosenbrock integrator used if the step mode is ODEStepMode::Rosenbrock
+    ODESolverRosenbrock rosenbrock;
+
     /// The CVODE context pointer
     void* cvode_mem;
 
@@ -99,7 +433,7 @@ struct ODESolver::Impl
 
     /// Construct a default ODESolver::Impl instance
     Impl()
-    : cvode_mem(0), cvode_y(0)
+    : rosenbrock(problem, options), cvode_mem(0), cvode_y(0)
     {}
 
     ~Impl()
@@ -124,6 +458,13 @@ struct ODESolver::Impl
             "Cannot proceed with ODESolver::initialize to initialize the solver.",
             "The dimension of the vector parameter `y` does not match the number of equations.");
 
+        // Initialize the native Rosenbrock integrator if it has been chosen, without reusing its Jacobian
+        if(options.step == ODEStepMode::Rosenbrock)
+        {
+            rosenbrock.reset();
+            return rosenbrock.initialize(tstart, y);
+        }
+
         // The number of differential equations
         const int num_equations = problem.numEquations();
 
@@ -193,6 +534,10 @@ struct ODESolver::Impl
     /// Integrate the ODE performing a single step.
     auto integrate(double& t, VectorRef y) -> void
     {
+        // Use the native Rosenbrock integrator if it has been chosen
+        if(options.step == ODEStepMode::Rosenbrock)
+            return rosenbrock.integrate(t, y);
+
         // Initialize the ODE data
         ODEData data(problem, y, f, J);
 
@@ -213,6 +558,10 @@ struct ODESolver::Impl
     /// Integrate the ODE performing a single step not going over a given time.
     auto integrate(double& t, VectorRef y, double tfinal) -> void
     {
+        // Use the native Rosenbrock integrator if it has been chosen
+        if(options.step == ODEStepMode::Rosenbrock)
+            return rosenbrock.integrate(t, y, tfinal);
+
         // Initialize the ODE data
         ODEData data(problem, y, f, J);
 
@@ -240,6 +589,15 @@ struct ODESolver::Impl
     /// Solve the ODE equations from a given start time to a final one.
     auto solve(double& t, double dt, VectorRef y) -> void
     {
+        // Use the native Rosenbrock integrator if it has been chosen, without re-initializing its memory
+        if(options.step == ODEStepMode::Rosenbrock)
+        {
+            Assert(problem.initialized() && y.size() == problem.numEquations(),
+                "Cannot proceed with ODESolver::solve to integrate the differential equations.",
+                "The ODE problem was not properly initialized or its dimension does not match `y`.");
+            return rosenbrock.solve(t, dt, y);
+        }
+
         // Initialize the cvode context
         initialize(t, y);
 
@@ -256,6 +614,26 @@ struct ODESolver::Impl
         for(int i = 0; i < data.num_equations; ++i)
             y[i] = VecEntry(this->cvode_y, i);
     }
+
+    /// Calculate the variables at a given time within the last integration step.
+    auto interpolate(double t, VectorRef y) -> void
+    {
+        // Use the dense output of the native Rosenbrock integrator if it has been chosen
+        if(options.step == ODEStepMode::Rosenbrock)
+            return rosenbrock.interpolate(t, y);
+
+        // Interpolate y at t using the CVODE interpolating polynomial
+        const int num_equations = problem.numEquations();
+        N_Vector cvode_yt = N_VNew_Serial(num_equations);
+        const int res = CVodeGetDky(cvode_mem, t, 0, cvode_yt);
+        for(int i = 0; i < num_equations; ++i)
+            y[i] = VecEntry(cvode_yt, i);
+        N_VDestroy_Serial(cvode_yt);
+
+        Assert(res == CV_SUCCESS,
+            "Cannot proceed with ODESolver::interpolate to calculate the variables at the given time.",
+            "There was a failure in the CVODE call `CVodeGetDky`.");
+    }
 };
 
 inline int CVODEStep(const ODEStepMode& step)
@@ -399,6 +777,7 @@ auto ODESolver::setOptions(const ODEOptions& options) -> void
 auto ODESolver::setProblem(const ODEProblem& problem) -> void
 {
     pimpl->problem = problem;
+    pimpl->rosenbrock.reset();
 }
 
 auto ODESolver::initialize(double tstart, VectorConstRef y) -> void
@@ -421,4 +800,9 @@ auto ODESolver::solve(double& t, double dt, VectorRef y) -> void
     pimpl->solve(t, dt, y);
 }
 
+auto ODESolver::interpolate(double t, VectorRef y) -> void
+{
+    pimpl->interpolate(t, y);
+}
+
 } // namespace Reaktoro
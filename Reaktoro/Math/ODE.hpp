@@ -32,8 +32,11 @@ using ODEFunction = std::function<int(double, VectorConstRef, VectorRef)>;
 /// The function signature of the Jacobian of the right-hand side function of a system of ordinary differential equations.
 using ODEJacobian = std::function<int(double, VectorConstRef, MatrixRef)>;
 
-/// The linear multistep method to be used in ODESolver.
-enum class ODEStepMode { Adams, BDF };
+/// The integration method to be used in ODESolver.
+/// The methods `Adams` and `BDF` are the linear multistep methods of `CVODE`. The method `Rosenbrock`
+/// is a native second-order Rosenbrock method with dense output, which reuses its Jacobian evaluations,
+/// LU factorizations and step size across calls, and is thus more efficient for many short integrations.
+enum class ODEStepMode { Adams, BDF, Rosenbrock };
 
 /// The type of nonlinear solver iteration to be used in ODESolver.
 enum class ODEIterationMode { Functional, Newton };
@@ -92,6 +95,9 @@ struct ODEOptions
     /// The maximum number of error test failures.
     unsigned max_num_error_test_failures = 20;
 
+    /// The maximum number of steps a Jacobian evaluation is reused in the Rosenbrock method.
+    unsigned max_jacobian_age = 20;
+
     /// The maximum number of nonlinear iterations.
     unsigned max_num_nonlinear_iterations = 3;
 
@@ -163,7 +169,7 @@ private:
     std::unique_ptr<Impl> pimpl;
 };
 
-/// A wrapper class for `CVODE`, a library for solving ordinary differential equations.
+/// A class for solving ordinary differential equations with `CVODE` or a native Rosenbrock method.
 /// @see ODEProblem, ODEOptions
 class ODESolver
 {
@@ -211,6 +217,11 @@ public:
     /// @param[in,out] y The current variables as input, the new current variables as output
     auto solve(double& t, double dt, VectorRef y) -> void;
 
+    /// Calculate the variables at a given time within the last integration step.
+    /// @param t The time at which the variables are calculated
+    /// @param[out] y The variables at time `t`
+    auto interpolate(double t, VectorRef y) -> void;
+
 private:
     struct Impl;
 
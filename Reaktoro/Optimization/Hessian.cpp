@@ -22,14 +22,32 @@
 
 namespace Reaktoro {
 
+auto dense(const Hessian& H) -> Matrix
+{
+    if(H.mode == Hessian::Dense)
+        return H.dense;
+    if(H.mode == Hessian::Diagonal)
+        return diag(H.diagonal);
+    if(H.mode == Hessian::DiagonalLowRank)
+    {
+        Matrix res = H.U * tr(H.V);
+        res.diagonal() += H.diagonal;
+        return res;
+    }
+    RuntimeError("Could not convert a Hessian matrix to a dense matrix.",
+        "The Hessian matrix must be in either Dense, Diagonal or DiagonalLowRank mode.");
+}
+
 auto operator*(const Hessian& H, VectorConstRef x) -> Vector
 {
     if(H.mode == Hessian::Dense)
         return H.dense * x;
     if(H.mode == Hessian::Diagonal)
         return H.diagonal % x;
+    if(H.mode == Hessian::DiagonalLowRank)
+        return H.diagonal % x + H.U * (tr(H.V) * x);
     RuntimeError("Could not multiply a Hessian matrix with a vector.",
-        "The Hessian matrix must be in either Dense or Diagonal mode.");
+        "The Hessian matrix must be in either Dense, Diagonal or DiagonalLowRank mode.");
 }
 
 } // namespace Reaktoro
@@ -26,7 +26,7 @@ namespace Reaktoro {
 struct Hessian
 {
     /// An enumeration of possible modes for an Hessian representation
-    enum Mode { Dense, Diagonal, Inverse };
+    enum Mode { Dense, Diagonal, Inverse, DiagonalLowRank };
 
     /// The mode of the Hessian.
     /// It is the responsibility of the user to set the appropriate `mode`
@@ -46,8 +46,19 @@ struct Hessian
 
     /// The Hessian matrix represented as a diagonal matrix
     Vector diagonal;
+
+    /// The left factor `U` of the Hessian matrix represented as `diag(diagonal) + U*tr(V)`.
+    /// This representation is used in the `DiagonalLowRank` mode, in which the number
+    /// of columns of `U` and `V` is expected to be much smaller than their number of rows.
+    Matrix U;
+
+    /// The right factor `V` of the Hessian matrix represented as `diag(diagonal) + U*tr(V)`.
+    Matrix V;
 };
 
+/// Return the Hessian matrix as a dense matrix.
+auto dense(const Hessian& H) -> Matrix;
+
 /// Return the multiplication of a Hessian matrix and a vector.
 auto operator*(const Hessian& H, VectorConstRef x) -> Vector;
 
@@ -86,14 +86,23 @@ struct KktSolverRangespaceDiagonal : KktSolverBase
 
     Vector X, Z;
     Vector D, D1, D2;
+
+    /// The matrix `[A; tr(V)]`, or just `A` if the Hessian matrix has no low-rank part `U*tr(V)`
+    Matrix AV;
+
+    /// The matrix `[A; -tr(U)]`, or just `A` if the Hessian matrix has no low-rank part `U*tr(V)`
+    Matrix AU;
+
     Matrix A1, A2;
+    Matrix B1, B2;
     Vector a1, a2;
     Vector dx1, dx2;
     Vector r;
 
     Vector invD1;
     Matrix A1invD1;
-    Matrix A1invD1A1t;
+    Matrix B1invD1;
+    Matrix A1invD1B1t;
 
     Vector kkt_rhs, kkt_sol;
     Matrix kkt_lhs;
@@ -106,6 +115,9 @@ struct KktSolverRangespaceDiagonal : KktSolverBase
     virtual auto decompose(const KktMatrix& lhs) -> void;
 
     /// Solve the KKT problem using an efficient rangespace decomposition approach.
+    /// The low-rank part `U*tr(V)` of a Hessian matrix in DiagonalLowRank mode is
+    /// handled with the auxiliary variables `w = tr(V)*dx`, which results in a KKT
+    /// equation with diagonal Hessian and coefficient matrices `[A; tr(V)]` and `[A; -tr(U)]`.
     /// Note that this method requires `decompose` to be called a priori.
     virtual auto solve(const KktVector& rhs, KktSolution& sol) -> void;
 };
@@ -160,9 +172,9 @@ auto KktSolverDense<LUSolver>::decompose(const KktMatrix& lhs) -> void
     z = lhs.z;
 
     // Check if the Hessian matrix is in the dense mode
-    Assert(lhs.H.mode == Hessian::Dense || lhs.H.mode == Hessian::Diagonal,
+    Assert(lhs.H.mode != Hessian::Inverse,
         "Cannot solve the KKT equation using PartialPivLU or FullPivLU algorithms.",
-        "The Hessian matrix must be in Dense or Diagonal mode.");
+        "The Hessian matrix must be in Dense, Diagonal or DiagonalLowRank mode.");
 
     // Auxiliary references to the KKT matrix components
     const auto& H = lhs.H;
@@ -181,7 +193,8 @@ auto KktSolverDense<LUSolver>::decompose(const KktMatrix& lhs) -> void
 
     // Assemble the left-hand side of the KKT equation
     if(H.mode == Hessian::Dense) kkt_lhs.block(0, 0, n, n).noalias() = H.dense;
-    else kkt_lhs.block(0, 0, n, n) = diag(H.diagonal);
+    else if(H.mode == Hessian::Diagonal) kkt_lhs.block(0, 0, n, n) = diag(H.diagonal);
+    else kkt_lhs.block(0, 0, n, n).noalias() = dense(H);
     kkt_lhs.block(0, 0, n, n).diagonal() +=  z/x;
     kkt_lhs.block(0, 0, n, n).diagonal() +=  gamma*gamma*ones(n);
     kkt_lhs.block(0, n, n, m).noalias() = -tr(A);
@@ -277,10 +290,10 @@ auto KktSolverRangespaceInverse::solve(const KktVector& rhs, KktSolution& sol) -
 
 auto KktSolverRangespaceDiagonal::decompose(const KktMatrix& lhs) -> void
 {
-    // Check if the Hessian matrix is diagonal
-    Assert(lhs.H.mode == Hessian::Diagonal,
+    // Check if the Hessian matrix is diagonal or diagonal plus low-rank
+    Assert(lhs.H.mode == Hessian::Diagonal || lhs.H.mode == Hessian::DiagonalLowRank,
         "Cannot solve the KKT equation using the rangespace algorithm.",
-        "The Hessian matrix must be in Diagonal mode.");
+        "The Hessian matrix must be in Diagonal or DiagonalLowRank mode.");
 
     // Initialize diagonal matrices X and Z
     X = lhs.x;
@@ -292,9 +305,23 @@ auto KktSolverRangespaceDiagonal::decompose(const KktMatrix& lhs) -> void
     const auto& gamma = lhs.gamma;
     const auto& delta = lhs.delta;
 
+    // The number of columns of the low-rank factors `U` and `V` of the Hessian matrix
+    const unsigned k = (lhs.H.mode == Hessian::DiagonalLowRank) ? lhs.H.U.cols() : 0;
+
     const unsigned n = A.cols();
     const unsigned m = A.rows();
 
+    // Assemble the coefficient matrices `[A; tr(V)]` and `[A; -tr(U)]`
+    AV.resize(m + k, n);
+    AU.resize(m + k, n);
+    AV.topRows(m) = A;
+    AU.topRows(m) = A;
+    if(k)
+    {
+        AV.bottomRows(k) = tr(lhs.H.V);
+        AU.bottomRows(k) = -tr(lhs.H.U);
+    }
+
     D.noalias() = H + Z/X + gamma*gamma*ones(n);
 
     ipivot.clear();
@@ -302,27 +329,31 @@ auto KktSolverRangespaceDiagonal::decompose(const KktMatrix& lhs) -> void
     ipivot.reserve(n);
     inonpivot.reserve(n);
     for(unsigned i = 0; i < n; ++i)
-        if(D[i] > norminf(A.col(i))) ipivot.push_back(i);
+        if(D[i] > std::max(norminf(AV.col(i)), norminf(AU.col(i)))) ipivot.push_back(i);
         else inonpivot.push_back(i);
 
     D1 = rows(D, ipivot);
     D2 = rows(D, inonpivot);
-    A1 = cols(A, ipivot);
-    A2 = cols(A, inonpivot);
+    A1 = cols(AV, ipivot);
+    A2 = cols(AV, inonpivot);
+    B1 = cols(AU, ipivot);
+    B2 = cols(AU, inonpivot);
 
     invD1.noalias() = inv(D1);
     A1invD1.noalias() = A1*diag(invD1);
-    A1invD1A1t.noalias() = A1invD1*tr(A1);
+    B1invD1.noalias() = B1*diag(invD1);
+    A1invD1B1t.noalias() = A1invD1*tr(B1);
 
     const unsigned n2 = inonpivot.size();
-    const unsigned t  = m + n2;
+    const unsigned t  = m + k + n2;
 
     kkt_lhs = zeros(t, t);
     kkt_lhs.topLeftCorner(n2, n2).diagonal() = D2;
-    kkt_lhs.topRightCorner(n2, m).noalias() = -tr(A2);
-    kkt_lhs.bottomLeftCorner(m, n2).noalias() = A2;
-    kkt_lhs.bottomRightCorner(m, m).noalias() = A1invD1A1t;
-    kkt_lhs.bottomRightCorner(m, m).diagonal() += delta*delta*ones(m);
+    kkt_lhs.topRightCorner(n2, m + k).noalias() = -tr(B2);
+    kkt_lhs.bottomLeftCorner(m + k, n2).noalias() = A2;
+    kkt_lhs.bottomRightCorner(m + k, m + k).noalias() = A1invD1B1t;
+    kkt_lhs.block(n2, n2, m, m).diagonal() += delta*delta*ones(m);
+    kkt_lhs.bottomRightCorner(k, k).diagonal() -= ones(k);
 
     lu.compute(kkt_lhs);
 }
@@ -344,12 +375,15 @@ auto KktSolverRangespaceDiagonal::solve(const KktVector& rhs, KktSolution& sol)
     const unsigned n1 = A1.cols();
     const unsigned n2 = A2.cols();
     const unsigned n  = n1 + n2;
-    const unsigned m  = A1.rows();
-    const unsigned t  = n2 + m;
+    const unsigned m  = b.rows();
+    const unsigned k  = A1.rows() - m;
+    const unsigned t  = n2 + m + k;
 
     kkt_rhs.resize(t);
     kkt_rhs.segment( 0, n2).noalias() = a2;
-    kkt_rhs.segment(n2,  m).noalias() = b - A1invD1*a1;
+    kkt_rhs.segment(n2,  m).noalias() = b;
+    kkt_rhs.segment(n2 + m, k).setZero();
+    kkt_rhs.segment(n2, m + k).noalias() -= A1invD1*a1;
 
     kkt_sol.noalias() = lu.solve(kkt_rhs);
 
@@ -358,7 +392,7 @@ auto KktSolverRangespaceDiagonal::solve(const KktVector& rhs, KktSolution& sol)
 
     dy.noalias() = kkt_sol.segment(n2, m);
 
-    dx1.noalias() = a1 % invD1 + tr(A1invD1)*dy;
+    dx1.noalias() = a1 % invD1 + tr(B1invD1)*kkt_sol.segment(n2, m + k);
     dx2.noalias() = kkt_sol.segment(0, n2);
 
     dx.resize(n);
@@ -416,9 +450,9 @@ auto KktSolverNullspace::decompose(const KktMatrix& lhs) -> void
     this->lhs = &lhs;
 
     // Check if the Hessian matrix is dense
-    Assert(lhs.H.mode == Hessian::Dense || lhs.H.mode == Hessian::Diagonal,
+    Assert(lhs.H.mode != Hessian::Inverse,
         "Cannot solve the KKT equation using the nullspace algorithm.",
-        "The Hessian matrix must be either in the Dense or Diagonal mode.");
+        "The Hessian matrix must be either in the Dense, Diagonal or DiagonalLowRank mode.");
 
     // Auxiliary references to the KKT matrix components
     const auto& x = lhs.x;
@@ -430,7 +464,9 @@ auto KktSolverNullspace::decompose(const KktMatrix& lhs) -> void
     initialize(A);
 
     // Set matrix `G = H + inv(X)*Z`
-    G.noalias() = (H.mode == Hessian::Dense) ? H.dense : diag(H.diagonal);
+    if(H.mode == Hessian::Dense) G.noalias() = H.dense;
+    else if(H.mode == Hessian::Diagonal) G = diag(H.diagonal);
+    else G.noalias() = dense(H);
     G.diagonal() += z/x;
 
     // Compute the reduced Hessian matrix
@@ -502,7 +538,7 @@ auto KktSolver::Impl::decompose(const KktMatrix& lhs) -> void
         if(lhs.H.mode == Hessian::Dense)
             base = &kkt_partial_lu;
 
-        if(lhs.H.mode == Hessian::Diagonal)
+        if(lhs.H.mode == Hessian::Diagonal || lhs.H.mode == Hessian::DiagonalLowRank)
             base = &kkt_rangespace_diagonal;
 
         if(lhs.H.mode == Hessian::Inverse)
@@ -520,7 +556,7 @@ auto KktSolver::Impl::decompose(const KktMatrix& lhs) -> void
 
     if(options.method == KktMethod::Rangespace)
     {
-        if(lhs.H.mode == Hessian::Diagonal)
+        if(lhs.H.mode == Hessian::Diagonal || lhs.H.mode == Hessian::DiagonalLowRank)
             base = &kkt_rangespace_diagonal;
 
         if(lhs.H.mode == Hessian::Inverse)
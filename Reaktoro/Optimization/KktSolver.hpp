@@ -43,11 +43,11 @@ struct KktResult
 enum class KktMethod
 {
     /// Use a partial pivoting LU algorithm on the full KKT equation.
-    /// This can only be used for dense Hessian matrices.
+    /// This cannot be used for Hessian matrices represented by their inverse.
     PartialPivLU,
 
     /// Use a full pivoting LU algorithm on the full KKT equation.
-    /// This can only be used for dense Hessian matrices.
+    /// This cannot be used for Hessian matrices represented by their inverse.
     FullPivLU,
 
     /// Use a nullspace method to solve the KKT equation.
@@ -57,12 +57,14 @@ enum class KktMethod
 
     /// Use a rangespace method to solve the KKT equation.
     /// This method is advisable when the Hessian matrix can be easily
-    /// inverted such as a quasi-Newton approximation or a diagonal matrix.
+    /// inverted such as a quasi-Newton approximation, a diagonal matrix,
+    /// or a diagonal matrix plus a low-rank matrix.
     Rangespace,
 
     /// Use a method that fits better to the type of KKT equation.
     /// This option will ensure that a rangespace method is used when
-    /// the Hessian matrix is diagonal or its inverse is available.
+    /// the Hessian matrix is diagonal (possibly plus a low-rank matrix)
+    /// or its inverse is available.
     /// It will use a `PartialPivLU` method for dense KKT equations.
     Automatic,
 };
@@ -300,9 +300,14 @@ auto OptimumSolverActNewton::Impl::solve(const OptimumProblem& problem, OptimumS
             break;
         case Hessian::Diagonal:
             HF.diagonal = rows(f.hessian.diagonal, F); break;
+        case Hessian::DiagonalLowRank:
+            HF.diagonal = rows(f.hessian.diagonal, F);
+            HF.U = rows(f.hessian.U, F);
+            HF.V = rows(f.hessian.V, F);
+            break;
         default:
             RuntimeError("Could not solve the optimization problem with given Hessian.",
-                "OptimumSolverActNewton only accepts `Dense` or `Diagonal` Hessian matrices.");
+                "OptimumSolverActNewton only accepts `Dense`, `Diagonal` or `DiagonalLowRank` Hessian matrices.");
         }
     };
 
@@ -209,6 +209,11 @@ auto OptimumSolverIpActive::Impl::solve(const OptimumProblem& problem, OptimumSt
                 f_stable.hessian.diagonal = rows(f.hessian.diagonal, istable_variables);
             if(f.hessian.inverse.size())
                 f_stable.hessian.inverse = submatrix(f.hessian.inverse, istable_variables, istable_variables);
+            if(f.hessian.mode == Hessian::DiagonalLowRank)
+            {
+                f_stable.hessian.U = rows(f.hessian.U, istable_variables);
+                f_stable.hessian.V = rows(f.hessian.V, istable_variables);
+            }
 
             return f_stable;
         };
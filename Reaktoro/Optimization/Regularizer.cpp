@@ -401,6 +401,11 @@ auto Regularizer::Impl::removeTrivialConstraints(
                 res.hessian.diagonal = f.hessian.diagonal(inontrivial_variables);
             if(f.hessian.inverse.size())
                 res.hessian.inverse = f.hessian.inverse(inontrivial_variables, inontrivial_variables);
+            if(f.hessian.mode == Hessian::DiagonalLowRank)
+            {
+                res.hessian.U = rows(f.hessian.U, inontrivial_variables);
+                res.hessian.V = rows(f.hessian.V, inontrivial_variables);
+            }
 
             return res;
         };
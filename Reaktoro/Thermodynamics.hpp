@@ -34,6 +34,7 @@
 #include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelHKF.hpp>
 #include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelIdeal.hpp>
 #include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelPitzerHMW.hpp>
+#include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelUtils.hpp>
 #include <Reaktoro/Thermodynamics/Models/GaseousChemicalModelCubicEOS.hpp>
 #include <Reaktoro/Thermodynamics/Models/GaseousChemicalModelIdeal.hpp>
 #include <Reaktoro/Thermodynamics/Models/GaseousChemicalModelSpycherPruessEnnis.hpp>
@@ -67,5 +68,6 @@
 #include <Reaktoro/Thermodynamics/Water/WaterHelmholtzStateHGK.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterHelmholtzStateWagnerPruss.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoState.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoStateTable.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoStateUtils.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterUtils.hpp>
@@ -18,8 +18,13 @@
 #include "Database.hpp"
 
 // C++ includes
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <map>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -377,6 +382,301 @@ auto speciesWithElements(const std::vector<std::string>& elements, const std::ma
     return collectSpecies(map, f);
 }
 
+/// The bytes at the beginning of a binary snapshot of a database (see Database::save)
+const std::string snapshot_header = "Reaktoro Database Snapshot v1";
+
+/// A type used to write the contents of a database into a binary snapshot.
+/// Numbers are written with their native binary representation, so that a snapshot
+/// is intended to be loaded on machines with the same architecture that generated it.
+struct SnapshotWriter
+{
+    /// The bytes of the snapshot
+    std::string bytes;
+
+    template<typename T>
+    auto writeValue(T value) -> void
+    {
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    auto writeString(const std::string& str) -> void
+    {
+        writeValue<std::uint64_t>(str.size());
+        bytes.append(str);
+    }
+
+    auto writeVector(const std::vector<double>& values) -> void
+    {
+        writeValue<std::uint64_t>(values.size());
+        bytes.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+    }
+
+    auto writeMap(const std::map<std::string, double>& map) -> void
+    {
+        writeValue<std::uint64_t>(map.size());
+        for(const auto& pair : map)
+        {
+            writeString(pair.first);
+            writeValue<double>(pair.second);
+        }
+    }
+
+    auto writeInterpolator(const BilinearInterpolator& interpolator) -> void
+    {
+        writeVector(interpolator.xCoodinates());
+        writeVector(interpolator.yCoodinates());
+        writeVector(interpolator.data());
+    }
+};
+
+/// A type used to read the contents of a database from a binary snapshot.
+struct SnapshotReader
+{
+    /// The bytes of the snapshot
+    std::string bytes;
+
+    /// The name of the snapshot file
+    std::string filename;
+
+    /// The position of the next byte to be read
+    std::size_t pos = 0;
+
+    auto read(void* dest, std::size_t size) -> void
+    {
+        Assert(size <= bytes.size() - pos,
+            "Cannot load the database snapshot `" + filename + "`.",
+            "The file is either truncated or corrupted.");
+        std::memcpy(dest, bytes.data() + pos, size);
+        pos += size;
+    }
+
+    template<typename T>
+    auto readValue() -> T
+    {
+        T value;
+        read(&value, sizeof(T));
+        return value;
+    }
+
+    auto readString() -> std::string
+    {
+        std::string str(readValue<std::uint64_t>(), '\0');
+        read(&str[0], str.size());
+        return str;
+    }
+
+    auto readVector() -> std::vector<double>
+    {
+        std::vector<double> values(readValue<std::uint64_t>());
+        read(values.data(), values.size() * sizeof(double));
+        return values;
+    }
+
+    auto readMap() -> std::map<std::string, double>
+    {
+        std::map<std::string, double> map;
+        const auto size = readValue<std::uint64_t>();
+        for(std::uint64_t i = 0; i < size; ++i)
+        {
+            std::string key = readString();
+            map.emplace(key, readValue<double>());
+        }
+        return map;
+    }
+
+    auto readInterpolator() -> BilinearInterpolator
+    {
+        std::vector<double> xcoordinates = readVector();
+        std::vector<double> ycoordinates = readVector();
+        std::vector<double> data = readVector();
+        if(data.empty()) return BilinearInterpolator();
+        return BilinearInterpolator(xcoordinates, ycoordinates, data);
+    }
+};
+
+/// Return the contents of a binary database snapshot file, or an empty string if the file is not a snapshot.
+auto readSnapshotFile(std::string filename) -> std::string
+{
+    std::ifstream file(filename, std::ios::binary);
+    std::string header(snapshot_header.size(), '\0');
+    if(!file.read(&header[0], header.size()) || header != snapshot_header)
+        return "";
+    std::stringstream contents;
+    contents << header << file.rdbuf();
+    return contents.str();
+}
+
+auto writeSpeciesThermoInterpolatedProperties(SnapshotWriter& writer, const SpeciesThermoInterpolatedProperties& data) -> void
+{
+    writer.writeInterpolator(data.gibbs_energy);
+    writer.writeInterpolator(data.helmholtz_energy);
+    writer.writeInterpolator(data.internal_energy);
+    writer.writeInterpolator(data.enthalpy);
+    writer.writeInterpolator(data.entropy);
+    writer.writeInterpolator(data.volume);
+    writer.writeInterpolator(data.heat_capacity_cp);
+    writer.writeInterpolator(data.heat_capacity_cv);
+}
+
+auto readSpeciesThermoInterpolatedProperties(SnapshotReader& reader) -> SpeciesThermoInterpolatedProperties
+{
+    SpeciesThermoInterpolatedProperties data;
+    data.gibbs_energy     = reader.readInterpolator();
+    data.helmholtz_energy = reader.readInterpolator();
+    data.internal_energy  = reader.readInterpolator();
+    data.enthalpy         = reader.readInterpolator();
+    data.entropy          = reader.readInterpolator();
+    data.volume           = reader.readInterpolator();
+    data.heat_capacity_cp = reader.readInterpolator();
+    data.heat_capacity_cv = reader.readInterpolator();
+    return data;
+}
+
+auto writeReactionThermoInterpolatedProperties(SnapshotWriter& writer, const ReactionThermoInterpolatedProperties& data) -> void
+{
+    writer.writeString(data.equation);
+    writer.writeInterpolator(data.lnk);
+    writer.writeInterpolator(data.gibbs_energy);
+    writer.writeInterpolator(data.helmholtz_energy);
+    writer.writeInterpolator(data.internal_energy);
+    writer.writeInterpolator(data.enthalpy);
+    writer.writeInterpolator(data.entropy);
+    writer.writeInterpolator(data.volume);
+    writer.writeInterpolator(data.heat_capacity_cp);
+    writer.writeInterpolator(data.heat_capacity_cv);
+}
+
+auto readReactionThermoInterpolatedProperties(SnapshotReader& reader) -> ReactionThermoInterpolatedProperties
+{
+    ReactionThermoInterpolatedProperties data;
+    const std::string equation = reader.readString();
+    if(!equation.empty()) data.equation = ReactionEquation(equation);
+    data.lnk              = reader.readInterpolator();
+    data.gibbs_energy     = reader.readInterpolator();
+    data.helmholtz_energy = reader.readInterpolator();
+    data.internal_energy  = reader.readInterpolator();
+    data.enthalpy         = reader.readInterpolator();
+    data.entropy          = reader.readInterpolator();
+    data.volume           = reader.readInterpolator();
+    data.heat_capacity_cp = reader.readInterpolator();
+    data.heat_capacity_cv = reader.readInterpolator();
+    return data;
+}
+
+auto writeSpeciesThermoParamsHKF(SnapshotWriter& writer, const AqueousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double value : {hkf.Gf, hkf.Hf, hkf.Sr, hkf.a1, hkf.a2, hkf.a3, hkf.a4, hkf.c1, hkf.c2, hkf.wref})
+        writer.writeValue<double>(value);
+}
+
+auto writeSpeciesThermoParamsHKF(SnapshotWriter& writer, const GaseousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double value : {hkf.Gf, hkf.Hf, hkf.Sr, hkf.a, hkf.b, hkf.c, hkf.Tmax})
+        writer.writeValue<double>(value);
+}
+
+auto writeSpeciesThermoParamsHKF(SnapshotWriter& writer, const MineralSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double value : {hkf.Gf, hkf.Hf, hkf.Sr, hkf.Vr, hkf.Tmax})
+        writer.writeValue<double>(value);
+    writer.writeValue<int>(hkf.nptrans);
+    for(const auto& values : {hkf.a, hkf.b, hkf.c, hkf.Ttr, hkf.Htr, hkf.Vtr, hkf.dPdTtr})
+        writer.writeVector(values);
+}
+
+auto readSpeciesThermoParamsHKF(SnapshotReader& reader, AqueousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double* value : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.a1, &hkf.a2, &hkf.a3, &hkf.a4, &hkf.c1, &hkf.c2, &hkf.wref})
+        *value = reader.readValue<double>();
+}
+
+auto readSpeciesThermoParamsHKF(SnapshotReader& reader, GaseousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double* value : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.a, &hkf.b, &hkf.c, &hkf.Tmax})
+        *value = reader.readValue<double>();
+}
+
+auto readSpeciesThermoParamsHKF(SnapshotReader& reader, MineralSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double* value : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.Vr, &hkf.Tmax})
+        *value = reader.readValue<double>();
+    hkf.nptrans = reader.readValue<int>();
+    for(std::vector<double>* values : {&hkf.a, &hkf.b, &hkf.c, &hkf.Ttr, &hkf.Htr, &hkf.Vtr, &hkf.dPdTtr})
+        *values = reader.readVector();
+}
+
+template<typename ThermoDataType>
+auto writeSpeciesThermoData(SnapshotWriter& writer, const ThermoDataType& thermo) -> void
+{
+    writer.writeValue<bool>(!thermo.properties.empty());
+    if(!thermo.properties.empty())
+        writeSpeciesThermoInterpolatedProperties(writer, thermo.properties.get());
+
+    writer.writeValue<bool>(!thermo.reaction.empty());
+    if(!thermo.reaction.empty())
+        writeReactionThermoInterpolatedProperties(writer, thermo.reaction.get());
+
+    writer.writeValue<bool>(!thermo.hkf.empty());
+    if(!thermo.hkf.empty())
+        writeSpeciesThermoParamsHKF(writer, thermo.hkf.get());
+}
+
+template<typename ThermoDataType, typename ThermoParamsHKF>
+auto readSpeciesThermoData(SnapshotReader& reader) -> ThermoDataType
+{
+    ThermoDataType thermo;
+
+    if(reader.readValue<bool>())
+        thermo.properties = readSpeciesThermoInterpolatedProperties(reader);
+
+    if(reader.readValue<bool>())
+        thermo.reaction = readReactionThermoInterpolatedProperties(reader);
+
+    if(reader.readValue<bool>())
+    {
+        ThermoParamsHKF hkf;
+        readSpeciesThermoParamsHKF(reader, hkf);
+        thermo.hkf = hkf;
+    }
+
+    return thermo;
+}
+
+auto writeSpecies(SnapshotWriter& writer, const Species& species) -> void
+{
+    writer.writeString(species.name());
+    writer.writeString(species.formula());
+    writer.writeValue<std::uint64_t>(species.elements().size());
+    for(const auto& pair : species.elements())
+    {
+        writer.writeString(pair.first.name());
+        writer.writeValue<double>(pair.second);
+    }
+}
+
+auto writeSpecies(SnapshotWriter& writer, const AqueousSpecies& species) -> void
+{
+    writeSpecies(writer, static_cast<const Species&>(species));
+    writer.writeValue<double>(species.charge());
+    writer.writeMap(species.dissociation());
+    writeSpeciesThermoData(writer, species.thermoData());
+}
+
+auto writeSpecies(SnapshotWriter& writer, const GaseousSpecies& species) -> void
+{
+    writeSpecies(writer, static_cast<const Species&>(species));
+    writer.writeValue<double>(species.criticalTemperature());
+    writer.writeValue<double>(species.criticalPressure());
+    writer.writeValue<double>(species.acentricFactor());
+    writeSpeciesThermoData(writer, species.thermoData());
+}
+
+auto writeSpecies(SnapshotWriter& writer, const MineralSpecies& species) -> void
+{
+    writeSpecies(writer, static_cast<const Species&>(species));
+    writeSpeciesThermoData(writer, species.thermoData());
+}
+
 } // namespace
 
 struct Database::Impl
@@ -393,11 +693,22 @@ struct Database::Impl
     /// The set of all mineral species in the database
     MineralSpeciesMap mineral_species_map;
 
+    /// The boolean flag that indicates if this database is shared by all Database instances initialized from the same file
+    bool shared = false;
+
     Impl()
     {}
 
     Impl(std::string filename)
     {
+        // Load the database from a binary snapshot file (see Database::save)
+        std::string snapshot = readSnapshotFile(filename);
+        if(!snapshot.empty())
+        {
+            load(snapshot, filename);
+            return;
+        }
+
         // Create the XML document
         xml_document doc;
 
@@ -579,6 +890,108 @@ struct Database::Impl
         }
     }
 
+    auto save() const -> std::string
+    {
+        SnapshotWriter writer;
+        writer.bytes = snapshot_header;
+
+        writer.writeValue<std::uint64_t>(element_map.size());
+        for(const auto& pair : element_map)
+        {
+            writer.writeString(pair.second.name());
+            writer.writeValue<double>(pair.second.molarMass());
+        }
+
+        writer.writeValue<std::uint64_t>(aqueous_species_map.size());
+        for(const auto& pair : aqueous_species_map)
+            writeSpecies(writer, pair.second);
+
+        writer.writeValue<std::uint64_t>(gaseous_species_map.size());
+        for(const auto& pair : gaseous_species_map)
+            writeSpecies(writer, pair.second);
+
+        writer.writeValue<std::uint64_t>(mineral_species_map.size());
+        for(const auto& pair : mineral_species_map)
+            writeSpecies(writer, pair.second);
+
+        return writer.bytes;
+    }
+
+    auto load(const std::string& snapshot, std::string filename) -> void
+    {
+        SnapshotReader reader;
+        reader.bytes = snapshot;
+        reader.filename = filename;
+        reader.pos = snapshot_header.size();
+
+        // Read all elements in the database, including the charge element
+        const auto num_elements = reader.readValue<std::uint64_t>();
+        for(std::uint64_t i = 0; i < num_elements; ++i)
+        {
+            Element element;
+            element.setName(reader.readString());
+            element.setMolarMass(reader.readValue<double>());
+            element_map[element.name()] = element;
+        }
+
+        // Read all species in the database
+        const auto num_aqueous_species = reader.readValue<std::uint64_t>();
+        for(std::uint64_t i = 0; i < num_aqueous_species; ++i)
+        {
+            AqueousSpecies species = loadSpecies(reader);
+            species.setCharge(reader.readValue<double>());
+            species.setDissociation(reader.readMap());
+            species.setThermoData(readSpeciesThermoData<AqueousSpeciesThermoData, AqueousSpeciesThermoParamsHKF>(reader));
+            if(valid(species))
+                aqueous_species_map[species.name()] = species;
+        }
+
+        const auto num_gaseous_species = reader.readValue<std::uint64_t>();
+        for(std::uint64_t i = 0; i < num_gaseous_species; ++i)
+        {
+            GaseousSpecies species = loadSpecies(reader);
+
+            // Set the critical properties of the gaseous species only if they were available (zero otherwise)
+            const auto Tc = reader.readValue<double>();
+            const auto Pc = reader.readValue<double>();
+            const auto omega = reader.readValue<double>();
+            if(Tc != 0.0) species.setCriticalTemperature(Tc);
+            if(Pc != 0.0) species.setCriticalPressure(Pc);
+            species.setAcentricFactor(omega);
+            species.setThermoData(readSpeciesThermoData<GaseousSpeciesThermoData, GaseousSpeciesThermoParamsHKF>(reader));
+            if(valid(species))
+                gaseous_species_map[species.name()] = species;
+        }
+
+        const auto num_mineral_species = reader.readValue<std::uint64_t>();
+        for(std::uint64_t i = 0; i < num_mineral_species; ++i)
+        {
+            MineralSpecies species = loadSpecies(reader);
+            species.setThermoData(readSpeciesThermoData<MineralSpeciesThermoData, MineralSpeciesThermoParamsHKF>(reader));
+            if(valid(species))
+                mineral_species_map[species.name()] = species;
+        }
+    }
+
+    auto loadSpecies(SnapshotReader& reader) -> Species
+    {
+        Species species;
+        species.setName(reader.readString());
+        species.setFormula(reader.readString());
+        std::map<Element, double> elements;
+        const auto num_elements = reader.readValue<std::uint64_t>();
+        for(std::uint64_t i = 0; i < num_elements; ++i)
+        {
+            const std::string name = reader.readString();
+            Assert(element_map.count(name),
+                "Cannot load the database snapshot `" + reader.filename + "`.",
+                "The element `" + name + "` of species `" + species.name() + "` is not in the database.");
+            elements.emplace(element_map.at(name), reader.readValue<double>());
+        }
+        species.setElements(elements);
+        return species;
+    }
+
     auto parseElement(const xml_node& node) -> Element
     {
         Element element;
@@ -709,26 +1122,64 @@ Database::Database()
 {}
 
 Database::Database(std::string filename)
-: pimpl(new Impl(filename))
-{}
+{
+    // The databases already initialized in this process, which are shared by all Database instances
+    // initialized from the same file and with the same global option for species with missing data
+    static std::map<std::pair<std::string, bool>, std::shared_ptr<Impl>> databases;
+    static std::mutex databases_mutex;
+
+    std::lock_guard<std::mutex> lock(databases_mutex);
+
+    auto& database = databases[{filename, global::options.database.exclude_species_with_missing_data}];
+    if(!database)
+    {
+        std::shared_ptr<Impl> impl(new Impl(filename));
+        impl->shared = true;
+        database = impl;
+    }
+
+    pimpl = database;
+}
+
+auto Database::save(std::string filename) const -> void
+{
+    std::ofstream file(filename, std::ios::binary);
+    const std::string snapshot = pimpl->save();
+    file.write(snapshot.data(), snapshot.size());
+    Assert(file.good(), "Could not save the database snapshot `" + filename + "`.",
+        "The file could not be opened or written.");
+}
+
+auto Database::detach() -> void
+{
+    if(pimpl->shared)
+    {
+        pimpl.reset(new Impl(*pimpl));
+        pimpl->shared = false;
+    }
+}
 
 auto Database::addElement(const Element& element) -> void
 {
+    detach();
     pimpl->addElement(element);
 }
 
 auto Database::addAqueousSpecies(const AqueousSpecies& species) -> void
 {
+    detach();
     pimpl->addAqueousSpecies(species);
 }
 
 auto Database::addGaseousSpecies(const GaseousSpecies& species) -> void
 {
+    detach();
     pimpl->addGaseousSpecies(species);
 }
 
 auto Database::addMineralSpecies(const MineralSpecies& species) -> void
 {
+    detach();
     pimpl->addMineralSpecies(species);
 }
 
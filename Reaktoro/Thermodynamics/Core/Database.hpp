@@ -71,9 +71,21 @@ public:
     /// database file is not found, then a default built-in database
     /// with the same name will be tried. If no default built-in database
     /// exist with given name, an exception will be thrown.
+    /// The file can also be a binary snapshot created with method @ref save,
+    /// which is loaded without any xml and string parsing.
+    /// A database file is parsed only once per process. All Database instances
+    /// initialized with the same file name share its contents, until species
+    /// or elements are added to them.
     /// @param filename The name of the database file
     explicit Database(std::string filename);
 
+    /// Save the contents of the database into a binary snapshot file.
+    /// The snapshot file can be used to initialize a Database instance much
+    /// faster than its original `xml` file. Note that it stores numbers
+    /// in the native binary format of the machine that created it.
+    /// @param filename The name of the snapshot file
+    auto save(std::string filename) const -> void;
+
     /// Add an Element instance in the database.
     auto addElement(const Element& element) -> void;
 
@@ -138,6 +150,9 @@ private:
     struct Impl;
 
     std::shared_ptr<Impl> pimpl;
+
+    /// Ensure the contents of this database are not shared with other instances before modifying them.
+    auto detach() -> void;
 };
 
 } // namespace Reaktoro
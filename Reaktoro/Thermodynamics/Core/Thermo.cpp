@@ -39,6 +39,7 @@ using namespace std::placeholders;
 #include <Reaktoro/Thermodynamics/Water/WaterElectroState.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterElectroStateJohnsonNorton.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoState.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoStateTable.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoStateUtils.hpp>
 
 namespace Reaktoro {
@@ -105,6 +106,12 @@ struct Thermo::Impl
 
         water_thermo_state_wagner_pruss_fn = memoize(water_thermo_state_wagner_pruss_fn);
 
+        // Initialize the functions that depend on the Wagner and Pruss (1995) equation of state for water
+        initializeWaterDependentFunctions();
+    }
+
+    auto initializeWaterDependentFunctions() -> void
+    {
         // Initialize the Johnson and Norton equation of state for the electrostatic state of water
         water_eletro_state_fn = [=](double T, double P)
         {
@@ -123,6 +130,15 @@ struct Thermo::Impl
         species_thermo_state_hkf_fn = memoize(species_thermo_state_hkf_fn);
     }
 
+    auto setWaterThermoStateTable(const WaterThermoStateTable& table) -> void
+    {
+        // The tabulated state is cheaper to interpolate than to look up in a memoized cache
+        water_thermo_state_wagner_pruss_fn = table;
+
+        // Reset the memoized functions, whose cached values were calculated with the previous equation of state
+        initializeWaterDependentFunctions();
+    }
+
     auto speciesThermoStateHKF(double T, double P, std::string species) -> SpeciesThermoState
     {
         if(database.containsAqueousSpecies(species))
@@ -675,4 +691,9 @@ auto Thermo::waterThermoStateWagnerPruss(double T, double P) -> WaterThermoState
     return pimpl->water_thermo_state_wagner_pruss_fn(T, P);
 }
 
+auto Thermo::setWaterThermoStateTable(const WaterThermoStateTable& table) -> void
+{
+    pimpl->setWaterThermoStateTable(table);
+}
+
 } // namespace Reaktoro
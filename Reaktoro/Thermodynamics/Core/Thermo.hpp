@@ -30,6 +30,7 @@ namespace Reaktoro {
 class Database;
 struct SpeciesThermoState;
 struct WaterThermoState;
+class WaterThermoStateTable;
 
 /// A type to calculate thermodynamic properties of chemical species
 class Thermo
@@ -149,6 +150,13 @@ public:
     /// @see WaterThermoState
     auto waterThermoStateWagnerPruss(double T, double P) -> WaterThermoState;
 
+    /// Set a table of the thermodynamic state of water to be used instead of the Wagner and Pruss (1995) equation of state.
+    /// The tabulated state of water is then used in the calculation of the standard
+    /// thermodynamic properties of the aqueous species and in @ref waterThermoStateWagnerPruss.
+    /// @param table The tabulated thermodynamic state of water
+    /// @see WaterThermoStateTable
+    auto setWaterThermoStateTable(const WaterThermoStateTable& table) -> void;
+
 private:
     struct Impl;
 
@@ -19,6 +19,8 @@
 
 // C++ includes
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
@@ -152,6 +154,70 @@ auto Psi(CubicEOS::Model type) -> double
     }
 }
 
+/// The number of reduced variables through which the properties of a species depend on composition.
+/// These are `amix`, `amixT`, `amixTT` and `bmix` of the phase, and the partial molar parameters `abar` and `abarT` of the species.
+const Index num_reduced = 6;
+
+/// The number of reduced variables through which the properties of the phase depend on composition.
+const Index num_reduced_phase = 4;
+
+/// The type of the derivatives with respect to the reduced variables.
+using ReducedRowVector = Eigen::Matrix<double, 1, num_reduced>;
+
+/// The type of a chemical scalar whose derivatives are with respect to the reduced variables instead of species amounts.
+using ReducedScalar = ChemicalScalarBase<double, ReducedRowVector>;
+
+/// Return a reduced variable with given value and T and P derivatives.
+auto reducedVariable(double val, double ddT, double ddP, Index k) -> ReducedScalar
+{
+    return ReducedScalar(val, ddT, ddP, ReducedRowVector::Unit(k));
+}
+
+/// Return a reduced scalar with a constant value.
+auto reducedConstant(const ThermoScalar& val) -> ReducedScalar
+{
+    return ReducedScalar(val.val, val.ddT, val.ddP, ReducedRowVector::Zero());
+}
+
+/// A matrix of binary parameters and its partial temperature and pressure derivatives.
+struct BinaryParamsMatrix
+{
+    Matrix val, ddT, ddP;
+
+    auto resize(Index nspecies) -> void
+    {
+        val.resize(nspecies, nspecies);
+        ddT.resize(nspecies, nspecies);
+        ddP.resize(nspecies, nspecies);
+    }
+
+    auto set(Index i, Index j, const ThermoScalar& aij) -> void
+    {
+        val(i, j) = aij.val;
+        ddT(i, j) = aij.ddT;
+        ddP(i, j) = aij.ddP;
+    }
+};
+
+/// Calculate the product of a matrix of binary parameters with the mole fractions of the species.
+auto multiply(const BinaryParamsMatrix& a, const ChemicalVector& x, ThermoVector& ax) -> void
+{
+    ax.val.noalias() = a.val * x.val;
+    ax.ddT.noalias() = a.ddT * x.val;
+    ax.ddT.noalias() += a.val * x.ddT;
+    ax.ddP.noalias() = a.ddP * x.val;
+    ax.ddP.noalias() += a.val * x.ddP;
+}
+
+/// Return the mixing rule `sum(x[i]*x[j]*a[i][j])` as the reduced variable of index `k`, given the product `ax` of `a` and `x`.
+auto quadraticMixingRule(const ThermoVector& ax, const ChemicalVector& x, Index k) -> ReducedScalar
+{
+    return reducedVariable(
+        x.val.dot(ax.val),
+        x.val.dot(ax.ddT) + x.ddT.dot(ax.val),
+        x.val.dot(ax.ddP) + x.ddP.dot(ax.val), k);
+}
+
 } // namespace internal
 
 struct CubicEOS::Impl
@@ -180,6 +246,24 @@ struct CubicEOS::Impl
     /// The result with thermodynamic properties calculated from the cubic equation of state
     Result result;
 
+    /// The temperature at which the binary parameters were last calculated (NaN if they need to be calculated).
+    ThermoScalar binary_params_temperature = ThermoScalar(std::numeric_limits<double>::quiet_NaN());
+
+    /// The parameters `b` of the species.
+    Vector b;
+
+    /// The binary parameters `aij` and their first and second temperature derivatives `aijT` and `aijTT`.
+    internal::BinaryParamsMatrix aij, aijT, aijTT;
+
+    /// The products of `aij`, `aijT` and `aijTT` with the mole fractions of the species.
+    ThermoVector ax, aTx, aTTx;
+
+    /// The products of `aij` and `aijT` with the partial molar derivatives of the mole fractions.
+    Matrix adx, aTdx;
+
+    /// The partial molar derivatives of the reduced variables of the phase.
+    Matrix reduced_ddn;
+
     /// Construct a CubicEOS::Impl instance.
     Impl(unsigned nspecies)
     : nspecies(nspecies)
@@ -190,20 +274,35 @@ struct CubicEOS::Impl
         result.residual_partial_molar_enthalpies = vec;
         result.residual_partial_molar_gibbs_energies = vec;
         result.ln_fugacity_coefficients = vec;
+
+        // Initialize the dimension of the workspace for the mixing rules
+        aij.resize(nspecies);
+        aijT.resize(nspecies);
+        aijTT.resize(nspecies);
+        ax.resize(nspecies);
+        aTx.resize(nspecies);
+        aTTx.resize(nspecies);
+        reduced_ddn.resize(internal::num_reduced_phase, nspecies);
     }
 
-    auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
+    /// Mark the binary parameters for recalculation after the parameters of the equation of state have changed.
+    auto reset() -> void
     {
-        // Check if the mole fractions are zero or non-initialized
-        if(x.val.size() == 0 || min(x.val) <= 0.0)
-            return Result(nspecies); // result with zero values
+        binary_params_temperature = ThermoScalar(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    /// Calculate the parameters `b` and the binary parameters `aij` of the species unless they were calculated at the same temperature.
+    auto updateBinaryParams(const ThermoScalar& T) -> void
+    {
+        if(T.val == binary_params_temperature.val && T.ddT == binary_params_temperature.ddT && T.ddP == binary_params_temperature.ddP)
+            return;
+
+        binary_params_temperature = T;
 
         // Auxiliary variables
         const double R = universalGasConstant;
         const double Psi = internal::Psi(model);
         const double Omega = internal::Omega(model);
-        const double epsilon = internal::epsilon(model);
-        const double sigma = internal::sigma(model);
         const auto alpha = internal::alpha(model);
 
         // Calculate the parameters `a` of the cubic equation of state for each species
@@ -225,7 +324,7 @@ struct CubicEOS::Impl
         };
 
         // Calculate the parameters `b` of the cubic equation of state for each species
-        Vector b(nspecies);
+        b.resize(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             const double Tci = critical_temperatures[i];
@@ -240,12 +339,7 @@ struct CubicEOS::Impl
         if(calculate_interaction_params)
             kres = calculate_interaction_params(kargs);
 
-        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        ChemicalScalar amix(nspecies);
-        ChemicalScalar amixT(nspecies);
-        ChemicalScalar amixTT(nspecies);
-        ChemicalVector abar(nspecies);
-        ChemicalVector abarT(nspecies);
+        // Calculate the binary parameters `aij` and their temperature derivatives
         for(unsigned i = 0; i < nspecies; ++i)
         {
             for(unsigned j = 0; j < nspecies; ++j)
@@ -258,138 +352,195 @@ struct CubicEOS::Impl
                 const ThermoScalar sT = 0.5*s/(a[i]*a[j]) * (aT[i]*a[j] + a[i]*aT[j]);
                 const ThermoScalar sTT = 0.5*s/(a[i]*a[j]) * (aTT[i]*a[j] + 2*aT[i]*aT[j] + a[i]*aTT[j]) - sT*sT/s;
 
-                const ThermoScalar aij = r*s;
-                const ThermoScalar aijT = rT*s + r*sT;
-                const ThermoScalar aijTT = rTT*s + 2.0*rT*sT + r*sTT;
-
-                amix += x[i] * x[j] * aij;
-                amixT += x[i] * x[j] * aijT;
-                amixTT += x[i] * x[j] * aijTT;
-
-                abar[i] += 2 * x[j] * aij;
-                abarT[i] += 2 * x[j] * aijT;
+                aij.set(i, j, r*s);
+                aijT.set(i, j, rT*s + r*sT);
+                aijTT.set(i, j, rTT*s + 2.0*rT*sT + r*sTT);
             }
         }
+    }
 
-        // Finalize the calculation of `abar` and `abarT`
-        for(unsigned i = 0; i < nspecies; ++i)
-        {
-            abar[i] -= amix;
-            abarT[i] -= amixT;
-        }
+    /// Calculate the compressibility factor as the root of the cubic equation of state appropriate for the phase.
+    auto compressibilityFactor(double A, double B, double C, double beta) const -> double
+    {
+        // Calculate the roots of the cubic equation analytically
+        const CubicRoots roots = cardano(1.0, A, B, C);
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const double candidates[] = {
+            std::get<0>(roots).imag() == 0.0 ? std::get<0>(roots).real() : nan,
+            std::get<1>(roots).imag() == 0.0 ? std::get<1>(roots).real() : nan,
+            std::get<2>(roots).imag() == 0.0 ? std::get<2>(roots).real() : nan };
+
+        // Choose the largest real root for a vapor phase, and the smallest one above `beta` for a liquid phase
+        double Z = nan;
+        for(double root : candidates)
+            if(std::isfinite(root) && root > beta)
+                if(std::isnan(Z) || (isvapor ? root > Z : root < Z))
+                    Z = root;
 
-        // Calculate the parameter `bmix` of the cubic equation of state
-        ChemicalScalar bmix(nspecies);
-        Vector bbar(nspecies);
-        for(unsigned i = 0; i < nspecies; ++i)
+        // Define the non-linear function and its derivative for calculation of its root
+        const auto f = [&](double Z) -> std::tuple<double, double>
         {
-            const double Tci = critical_temperatures[i];
-            const double Pci = critical_pressures[i];
-            bbar[i] = Omega*R*Tci/Pci;
-            bmix += x[i] * bbar[i];
-        }
+            const double val = Z*Z*Z + A*Z*Z + B*Z + C;
+            const double grad = 3*Z*Z + 2*A*Z + B;
+            return std::make_tuple(val, grad);
+        };
+
+        // Use Newton's method if no physical root was found
+        if(std::isnan(Z))
+            return newton(f, isvapor ? 1.0 : beta, 1e-6, 100);
+
+        // Refine the root with one Newton step to remove the round-off errors of the analytical solution
+        double val, grad;
+        std::tie(val, grad) = f(Z);
+        return grad != 0.0 ? Z - val/grad : Z;
+    }
+
+    /// Set a property of the phase from its value and derivatives with respect to the reduced variables.
+    auto assemble(const internal::ReducedScalar& s, ChemicalScalar& res) const -> void
+    {
+        res.val = s.val;
+        res.ddT = s.ddT;
+        res.ddP = s.ddP;
+        res.ddn.noalias() = s.ddn.head<internal::num_reduced_phase>() * reduced_ddn;
+    }
+
+    /// Set a property of a species from its value and derivatives with respect to the reduced variables.
+    auto assemble(const internal::ReducedScalar& s, Index i, ChemicalVector& res) const -> void
+    {
+        res.val[i] = s.val;
+        res.ddT[i] = s.ddT;
+        res.ddP[i] = s.ddP;
+        res.ddn.row(i).noalias() = s.ddn.head<internal::num_reduced_phase>() * reduced_ddn;
+        res.ddn.row(i) += 2*s.ddn[4]*adx.row(i) + 2*s.ddn[5]*aTdx.row(i);
+        res.ddn.row(i) -= s.ddn[4]*reduced_ddn.row(0) + s.ddn[5]*reduced_ddn.row(1);
+    }
+
+    auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
+    {
+        using internal::ReducedScalar;
+        using internal::reducedConstant;
+        using internal::reducedVariable;
+
+        // Check if the mole fractions are zero or non-initialized
+        if(x.val.size() == 0 || min(x.val) <= 0.0)
+            return Result(nspecies); // result with zero values
+
+        // Auxiliary variables
+        const double R = universalGasConstant;
+        const double epsilon = internal::epsilon(model);
+        const double sigma = internal::sigma(model);
+
+        // Calculate the binary parameters `aij` and the parameters `b` at this temperature
+        updateBinaryParams(T);
+
+        // Calculate the products of the binary parameters with the mole fractions
+        internal::multiply(aij, x, ax);
+        internal::multiply(aijT, x, aTx);
+        internal::multiply(aijTT, x, aTTx);
+
+        // Calculate the reduced variables `amix`, `amixT`, `amixTT` and `bmix` of the phase
+        const ReducedScalar amix = internal::quadraticMixingRule(ax, x, 0);
+        const ReducedScalar amixT = internal::quadraticMixingRule(aTx, x, 1);
+        const ReducedScalar amixTT = internal::quadraticMixingRule(aTTx, x, 2);
+        const ReducedScalar bmix = reducedVariable(b.dot(x.val), b.dot(x.ddT), b.dot(x.ddP), 3);
+
+        // Calculate the partial molar derivatives of the reduced variables of the phase
+        reduced_ddn.row(0).noalias() = 2*ax.val.transpose() * x.ddn;
+        reduced_ddn.row(1).noalias() = 2*aTx.val.transpose() * x.ddn;
+        reduced_ddn.row(2).noalias() = 2*aTTx.val.transpose() * x.ddn;
+        reduced_ddn.row(3).noalias() = b.transpose() * x.ddn;
+
+        // Calculate the partial molar derivatives of the sums `sum(x[j]*aij)` and `sum(x[j]*aijT)`
+        adx.noalias() = aij.val * x.ddn;
+        aTdx.noalias() = aijT.val * x.ddn;
 
         // Calculate the temperature derivative of `bmix`
         const double bmixT = 0.0; // no temperature dependence
 
         // Calculate auxiliary quantities `beta` and `q`
-        const ChemicalScalar beta = P*bmix/(R*T);
-        const ChemicalScalar betaT = beta * (bmixT/bmix - 1.0/T);
+        const ReducedScalar beta = P*bmix/(R*T);
+        const ReducedScalar betaT = beta * (bmixT/bmix - 1.0/T);
 
-        const ChemicalScalar q = amix/(bmix*R*T);
-        const ChemicalScalar qT = q*(amixT/amix - 1.0/T);
-        const ChemicalScalar qTT = qT*qT/q + q*(1.0/(T*T) + amixTT/amix - amixT*amixT/(amix*amix));
+        const ReducedScalar q = amix/(bmix*R*T);
+        const ReducedScalar qT = q*(amixT/amix - 1.0/T);
+        const ReducedScalar qTT = qT*qT/q + q*(1.0/(T*T) + amixTT/amix - amixT*amixT/(amix*amix));
 
         // Calculate the coefficients A, B, C of the cubic equation of state
-        const ChemicalScalar A = (epsilon + sigma - 1)*beta - 1;
-        const ChemicalScalar B = (epsilon*sigma - epsilon - sigma)*beta*beta - (epsilon + sigma - q)*beta;
-        const ChemicalScalar C = -epsilon*sigma*beta*beta*beta - (epsilon*sigma + q)*beta*beta;
+        const ReducedScalar A = (epsilon + sigma - 1)*beta - 1;
+        const ReducedScalar B = (epsilon*sigma - epsilon - sigma)*beta*beta - (epsilon + sigma - q)*beta;
+        const ReducedScalar C = -epsilon*sigma*beta*beta*beta - (epsilon*sigma + q)*beta*beta;
 
         // Calculate the partial temperature derivative of the coefficients A, B, C
-        const ChemicalScalar AT = (epsilon + sigma - 1)*betaT;
-        const ChemicalScalar BT = 2*(epsilon*sigma - epsilon - sigma)*beta*betaT + qT*beta - (epsilon + sigma - q)*betaT;
-        const ChemicalScalar CT = -3*epsilon*sigma*beta*beta*betaT - qT*beta*beta - 2*(epsilon*sigma + q)*beta*betaT;
+        const ReducedScalar AT = (epsilon + sigma - 1)*betaT;
+        const ReducedScalar BT = 2*(epsilon*sigma - epsilon - sigma)*beta*betaT + qT*beta - (epsilon + sigma - q)*betaT;
+        const ReducedScalar CT = -3*epsilon*sigma*beta*beta*betaT - qT*beta*beta - 2*(epsilon*sigma + q)*beta*betaT;
 
-        // Define the non-linear function and its derivative for calculation of its root
-        const auto f = [&](double Z) -> std::tuple<double, double>
-        {
-            const double val = Z*Z*Z + A.val*Z*Z + B.val*Z + C.val;
-            const double grad = 3*Z*Z + 2*A.val*Z + B.val;
-            return std::make_tuple(val, grad);
-        };
-
-        // Define the parameters for Newton's method
-        const auto tolerance = 1e-6;
-        const auto maxiter = 100;
-
-        // Determine the appropriate initial guess for the cubic equation of state
-        const double Z0 = isvapor ? 1.0 : beta.val;
-
-        // Calculate the compressibility factor Z using Newton's method
-        ChemicalScalar Z(nspecies);
-        Z.val = newton(f, Z0, tolerance, maxiter);
+        // Calculate the compressibility factor Z
+        ReducedScalar Z;
+        Z.val = compressibilityFactor(A.val, B.val, C.val, beta.val);
 
         // Calculate the partial derivatives of Z (dZdT, dZdP, dZdn)
         const double factor = -1.0/(3*Z.val*Z.val + 2*A.val*Z.val + B.val);
         Z.ddT = factor * (A.ddT*Z.val*Z.val + B.ddT*Z.val + C.ddT);
         Z.ddP = factor * (A.ddP*Z.val*Z.val + B.ddP*Z.val + C.ddP);
-        for(unsigned i = 0; i < nspecies; ++i)
-            Z.ddn[i] = factor * (A.ddn[i]*Z.val*Z.val + B.ddn[i]*Z.val + C.ddn[i]);
+        Z.ddn = factor * (A.ddn*Z.val*Z.val + B.ddn*Z.val + C.ddn);
 
         // Calculate the partial temperature derivative of Z
-        const ChemicalScalar ZT = -(AT*Z*Z + BT*Z + CT)/(3*Z*Z + 2*A*Z + B);
+        const ReducedScalar ZT = -(AT*Z*Z + BT*Z + CT)/(3*Z*Z + 2*A*Z + B);
 
         // Calculate the integration factor I and its temperature derivative IT
-        ChemicalScalar I;
+        ReducedScalar I;
         if(epsilon != sigma) I = log((Z + sigma*beta)/(Z + epsilon*beta))/(sigma - epsilon);
                         else I = beta/(Z + epsilon*beta);
 
         // Calculate the temperature derivative IT of the integration factor I
-        ChemicalScalar IT;
+        ReducedScalar IT;
         if(epsilon != sigma) IT = ((ZT + sigma*betaT)/(Z + sigma*beta) - (ZT + epsilon*betaT)/(Z + epsilon*beta))/(sigma - epsilon);
                         else IT = I*(betaT/beta - (ZT + epsilon*betaT)/(Z + epsilon*beta));
 
-        ChemicalScalar& V = result.molar_volume;
-        ChemicalScalar& G_res = result.residual_molar_gibbs_energy;
-        ChemicalScalar& H_res = result.residual_molar_enthalpy;
-        ChemicalScalar& Cp_res = result.residual_molar_heat_capacity_cp;
-        ChemicalScalar& Cv_res = result.residual_molar_heat_capacity_cv;
-        ChemicalVector& Vi = result.partial_molar_volumes;
-        ChemicalVector& Gi_res = result.residual_partial_molar_gibbs_energies;
-        ChemicalVector& Hi_res = result.residual_partial_molar_enthalpies;
-        ChemicalVector& ln_phi = result.ln_fugacity_coefficients;
+        // Calculate the molar properties of the phase
+        const ReducedScalar V = Z*R*T/P;
+        const ReducedScalar G_res = R*T*(Z - 1 - log(Z - beta) - q*I);
+        const ReducedScalar H_res = R*T*(Z - 1 + T*qT*I);
+        const ReducedScalar Cp_res = R*T*(ZT + qT*I + T*qTT + T*qT*IT) + H_res/T;
 
-        // Calculate the partial molar Zi for each species
-        V = Z*R*T/P;
-        G_res = R*T*(Z - 1 - log(Z - beta) - q*I);
-        H_res = R*T*(Z - 1 + T*qT*I);
-        Cp_res = R*T*(ZT + qT*I + T*qTT + T*qT*IT) + H_res/T;
+        const ReducedScalar dPdT = P*(1.0/T + ZT/Z);
+        const ReducedScalar dVdT = V*(1.0/T + ZT/Z);
 
-        const ChemicalScalar dPdT = P*(1.0/T + ZT/Z);
-        const ChemicalScalar dVdT = V*(1.0/T + ZT/Z);
+        const ReducedScalar Cv_res = Cp_res - T*dPdT*dVdT + R;
 
-        Cv_res = Cp_res - T*dPdT*dVdT + R;
+        assemble(V, result.molar_volume);
+        assemble(G_res, result.residual_molar_gibbs_energy);
+        assemble(H_res, result.residual_molar_enthalpy);
+        assemble(Cp_res, result.residual_molar_heat_capacity_cp);
+        assemble(Cv_res, result.residual_molar_heat_capacity_cv);
 
+        // Calculate the partial molar properties of each species
         for(unsigned i = 0; i < nspecies; ++i)
         {
-            const double bi = bbar[i];
-            const ThermoScalar betai = P*bi/(R*T);
-            const ChemicalScalar ai = abar[i];
-            const ChemicalScalar aiT = abarT[i];
-            const ChemicalScalar qi = q*(1 + ai/amix - bi/bmix);
-            const ChemicalScalar qiT = qi*qT/q + q*(aiT - ai*amixT/amix)/amix;
-            const ThermoScalar Ai = (epsilon + sigma - 1.0)*betai - 1.0;
-            const ChemicalScalar Bi = (epsilon*sigma - epsilon - sigma)*(2*beta*betai - beta*beta) - (epsilon + sigma - q)*(betai - beta) - (epsilon + sigma - qi)*beta;
-            const ChemicalScalar Ci = -3*sigma*epsilon*beta*beta*betai + 2*epsilon*sigma*beta*beta*beta - (epsilon*sigma + qi)*beta*beta - 2*(epsilon*sigma + q)*(beta*betai - beta*beta);
-            const ChemicalScalar Zi = -(Ai*Z*Z + (Bi + B)*Z + Ci + 2*C)/(3*Z*Z + 2*A*Z + B);
-            ChemicalScalar Ii;
+            const double bi = b[i];
+            const ReducedScalar betai = reducedConstant(P*bi/(R*T));
+            const ReducedScalar ai = reducedVariable(2*ax.val[i] - amix.val, 2*ax.ddT[i] - amix.ddT, 2*ax.ddP[i] - amix.ddP, 4);
+            const ReducedScalar aiT = reducedVariable(2*aTx.val[i] - amixT.val, 2*aTx.ddT[i] - amixT.ddT, 2*aTx.ddP[i] - amixT.ddP, 5);
+            const ReducedScalar qi = q*(1 + ai/amix - bi/bmix);
+            const ReducedScalar qiT = qi*qT/q + q*(aiT - ai*amixT/amix)/amix;
+            const ReducedScalar Ai = (epsilon + sigma - 1.0)*betai - 1.0;
+            const ReducedScalar Bi = (epsilon*sigma - epsilon - sigma)*(2*beta*betai - beta*beta) - (epsilon + sigma - q)*(betai - beta) - (epsilon + sigma - qi)*beta;
+            const ReducedScalar Ci = -3*sigma*epsilon*beta*beta*betai + 2*epsilon*sigma*beta*beta*beta - (epsilon*sigma + qi)*beta*beta - 2*(epsilon*sigma + q)*(beta*betai - beta*beta);
+            const ReducedScalar Zi = -(Ai*Z*Z + (Bi + B)*Z + Ci + 2*C)/(3*Z*Z + 2*A*Z + B);
+            ReducedScalar Ii;
             if(epsilon != sigma) Ii = I + ((Zi + sigma*betai)/(Z + sigma*beta) - (Zi + epsilon*betai)/(Z + epsilon*beta))/(sigma - epsilon);
                             else Ii = I * (1 + betai/beta - (Zi + epsilon*betai)/(Z + epsilon*beta));
 
-            Vi[i] = R*T*Zi/P;
-            Gi_res[i] = R*T*(Zi - (Zi - betai)/(Z - beta) - log(Z - beta) - qi*I - q*Ii + q*I);
-            Hi_res[i] = R*T*(Zi - 1 + T*(qiT*I + qT*Ii - qT*I));
-            ln_phi[i] = Gi_res[i]/(R*T);
+            const ReducedScalar Vi = R*T*Zi/P;
+            const ReducedScalar Gi_res = R*T*(Zi - (Zi - betai)/(Z - beta) - log(Z - beta) - qi*I - q*Ii + q*I);
+            const ReducedScalar Hi_res = R*T*(Zi - 1 + T*(qiT*I + qT*Ii - qT*I));
+            const ReducedScalar ln_phi = Gi_res/(R*T);
+
+            assemble(Vi, i, result.partial_molar_volumes);
+            assemble(Gi_res, i, result.residual_partial_molar_gibbs_energies);
+            assemble(Hi_res, i, result.residual_partial_molar_enthalpies);
+            assemble(ln_phi, i, result.ln_fugacity_coefficients);
         }
 
         return result;
@@ -436,6 +587,7 @@ auto CubicEOS::numSpecies() const -> unsigned
 auto CubicEOS::setModel(Model model) -> void
 {
     pimpl->model = model;
+    pimpl->reset();
 }
 
 auto CubicEOS::setPhaseAsLiquid() -> void
@@ -460,6 +612,7 @@ auto CubicEOS::setCriticalTemperatures(const std::vector<double>& values) -> voi
         "temperatures of the gases.");
 
     pimpl->critical_temperatures = values;
+    pimpl->reset();
 }
 
 auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
@@ -474,6 +627,7 @@ auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
         "pressures of the gases.");
 
     pimpl->critical_pressures = values;
+    pimpl->reset();
 }
 
 auto CubicEOS::setAcentricFactors(const std::vector<double>& values) -> void
@@ -484,11 +638,13 @@ auto CubicEOS::setAcentricFactors(const std::vector<double>& values) -> void
         std::to_string(values.size()) + " values were given.");
 
     pimpl->acentric_factors = values;
+    pimpl->reset();
 }
 
 auto CubicEOS::setInteractionParamsFunction(const InteractionParamsFunction& func) -> void
 {
     pimpl->calculate_interaction_params = func;
+    pimpl->reset();
 }
 
 auto CubicEOS::operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
@@ -28,6 +28,7 @@
 #include <Reaktoro/Thermodynamics/Water/WaterElectroState.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterElectroStateJohnsonNorton.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoState.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoStateTable.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoStateUtils.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterUtils.hpp>
 
@@ -81,6 +82,11 @@ auto AqueousMixture::setWaterDensity(const ThermoScalarFunction& rho) -> void
     this->rho = rho;
 }
 
+auto AqueousMixture::setWaterDensity(const WaterThermoStateTable& table) -> void
+{
+    this->rho = [=](double T, double P) { return table.density(T, P); };
+}
+
 auto AqueousMixture::setWaterDielectricConstant(const ThermoScalarFunction& epsilon) -> void
 {
     this->epsilon = epsilon;
@@ -204,18 +210,25 @@ auto AqueousMixture::chargesAnions() const -> Vector
 }
 
 auto AqueousMixture::molalities(VectorConstRef n) const -> ChemicalVector
+{
+    ChemicalVector m;
+    molalities(m, n);
+    return m;
+}
+
+auto AqueousMixture::molalities(ChemicalVector& m, VectorConstRef n) const -> void
 {
     const unsigned num_species = numSpecies();
 
-    // The molalities of the species and their partial derivatives
-    ChemicalVector m(num_species);
+    // Reset the molalities of the species and their partial derivatives
+    m.resize(num_species);
 
     // The molar amount of water
     const double nw = n[idx_water];
 
     // Check if the molar amount of water is zero
     if(nw == 0.0)
-        return m;
+        return;
 
     const double kgH2O = nw * waterMolarMass;
 
@@ -225,74 +238,95 @@ auto AqueousMixture::molalities(VectorConstRef n) const -> ChemicalVector
         m.ddn(i, i) = 1.0/kgH2O;
         m.ddn(i, idx_water) -= m.val[i]/nw;
     }
-
-    return m;
 }
 
 auto AqueousMixture::stoichiometricMolalities(const ChemicalVector& m) const -> ChemicalVector
+{
+    ChemicalVector ms;
+    stoichiometricMolalities(ms, m);
+    return ms;
+}
+
+auto AqueousMixture::stoichiometricMolalities(ChemicalVector& ms, const ChemicalVector& m) const -> void
 {
     // Auxiliary variables
     const unsigned num_species = numSpecies();
     const unsigned num_charged = numChargedSpecies();
     const unsigned num_neutral = numNeutralSpecies();
 
-    // The molalities of the charged species
-    ChemicalVector mc(num_charged, num_species);
-    mc.val = rows(m.val, idx_charged_species);
-    mc.ddn = rows(m.ddn, idx_charged_species);
-
-    // The molalities of the neutral species
-    ChemicalVector mn(num_neutral, num_species);
-    mn.val = rows(m.val, idx_neutral_species);
-    mn.ddn = rows(m.ddn, idx_neutral_species);
-
-    // The stoichiometric molalities of the charged species
-    ChemicalVector ms(num_charged, num_species);
-    ms.val = mc.val + tr(dissociation_matrix) * mn.val;
-    ms.ddn = mc.ddn + tr(dissociation_matrix) * mn.ddn;
+    // The stoichiometric molalities of the charged species start with their molalities
+    ms.resize(num_charged, num_species);
+    for(unsigned i = 0; i < num_charged; ++i)
+    {
+        ms.val[i] = m.val[idx_charged_species[i]];
+        ms.ddn.row(i) = m.ddn.row(idx_charged_species[i]);
+    }
 
-    return ms;
+    // Add the contributions of the ions produced from the dissociation of the neutral species
+    for(unsigned k = 0; k < num_neutral; ++k)
+    {
+        for(unsigned i = 0; i < num_charged; ++i)
+        {
+            const double coeff = dissociation_matrix(k, i);
+            if(coeff == 0.0) continue;
+            ms.val[i] += coeff * m.val[idx_neutral_species[k]];
+            ms.ddn.row(i) += coeff * m.ddn.row(idx_neutral_species[k]);
+        }
+    }
 }
 
 auto AqueousMixture::effectiveIonicStrength(const ChemicalVector& m) const -> ChemicalScalar
 {
-    const unsigned num_species = numSpecies();
-    const Vector z = chargesSpecies();
+    ChemicalScalar Ie;
+    effectiveIonicStrength(Ie, m);
+    return Ie;
+}
 
-    ChemicalScalar Ie(num_species);
-    Ie.val = 0.5 * sum(z % z % m.val);
-    for(unsigned i = 0; i < num_species; ++i)
-        Ie.ddn[i] = 0.5 * sum(z % z % m.ddn.col(i));
+auto AqueousMixture::effectiveIonicStrength(ChemicalScalar& Ie, const ChemicalVector& m) const -> void
+{
+    const Vector z = chargesSpecies();
+    const Vector zz = z % z;
 
-    return Ie;
+    Ie.val = 0.5 * sum(zz % m.val);
+    Ie.ddT = 0.0;
+    Ie.ddP = 0.0;
+    Ie.ddn.noalias() = 0.5 * tr(zz) * m.ddn;
 }
 
 auto AqueousMixture::stoichiometricIonicStrength(const ChemicalVector& ms) const -> ChemicalScalar
 {
-    const unsigned num_species = numSpecies();
-    const Vector zc = chargesChargedSpecies();
+    ChemicalScalar Is;
+    stoichiometricIonicStrength(Is, ms);
+    return Is;
+}
 
-    ChemicalScalar Is(num_species);
-    Is.val = 0.5 * sum(zc % zc % ms.val);
-    for(unsigned i = 0; i < num_species; ++i)
-        Is.ddn[i] = 0.5 * sum(zc % zc % ms.ddn.col(i));
+auto AqueousMixture::stoichiometricIonicStrength(ChemicalScalar& Is, const ChemicalVector& ms) const -> void
+{
+    const Vector zc = chargesChargedSpecies();
+    const Vector zz = zc % zc;
 
-    return Is;
+    Is.val = 0.5 * sum(zz % ms.val);
+    Is.ddT = 0.0;
+    Is.ddP = 0.0;
+    Is.ddn.noalias() = 0.5 * tr(zz) * ms.ddn;
 }
 
 auto AqueousMixture::state(Temperature T, Pressure P, VectorConstRef n) const -> AqueousMixtureState
 {
     AqueousMixtureState res;
-    res.T = T;
-    res.P = P;
-    res.x = moleFractions(n);
+    state(res, T, P, n);
+    return res;
+}
+
+auto AqueousMixture::state(AqueousMixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void
+{
+    GeneralMixture<AqueousSpecies>::state(res, T, P, n);
     res.rho = rho(T, P);
     res.epsilon = epsilon(T, P);
-    res.m  = molalities(n);
-    res.ms = stoichiometricMolalities(res.m);
-    res.Ie = effectiveIonicStrength(res.m);
-    res.Is = stoichiometricIonicStrength(res.ms);
-    return res;
+    molalities(res.m, n);
+    stoichiometricMolalities(res.ms, res.m);
+    effectiveIonicStrength(res.Ie, res.m);
+    stoichiometricIonicStrength(res.Is, res.ms);
 }
 
 auto AqueousMixture::initializeIndices(const std::vector<AqueousSpecies>& species) -> void
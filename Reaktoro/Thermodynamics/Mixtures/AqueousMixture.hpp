@@ -23,6 +23,9 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+class WaterThermoStateTable;
+
 /// A type used to describe the state of an aqueous mixture.
 /// @see AqueousMixture
 struct AqueousMixtureState : public MixtureState
@@ -72,6 +75,10 @@ public:
     /// Set a customized density function for water.
     auto setWaterDensity(const ThermoScalarFunction& rho) -> void;
 
+    /// Set the density function for water from tabulated thermodynamic states of water.
+    /// @see WaterThermoStateTable
+    auto setWaterDensity(const WaterThermoStateTable& table) -> void;
+
     /// Set a customized dielectric constant function for water.
     auto setWaterDielectricConstant(const ThermoScalarFunction& epsilon) -> void;
 
@@ -167,27 +174,55 @@ public:
     /// @return The molalities and their partial derivatives
     auto molalities(VectorConstRef n) const -> ChemicalVector;
 
+    /// Calculate the molalities of the aqueous species and its molar derivatives, reusing the memory of a given instance.
+    /// @param[out] m The molalities and their partial derivatives
+    /// @param n The molar abundance of species (in units of mol)
+    auto molalities(ChemicalVector& m, VectorConstRef n) const -> void;
+
     /// Calculate the stoichiometric molalities of the ions and its molar derivatives.
     /// @param m The molalities of the aqueous species and their partial derivatives
     /// @return The stoichiometric molalities and their partial derivatives
     auto stoichiometricMolalities(const ChemicalVector& m) const -> ChemicalVector;
 
+    /// Calculate the stoichiometric molalities of the ions and its molar derivatives, reusing the memory of a given instance.
+    /// @param[out] ms The stoichiometric molalities and their partial derivatives
+    /// @param m The molalities of the aqueous species and their partial derivatives
+    auto stoichiometricMolalities(ChemicalVector& ms, const ChemicalVector& m) const -> void;
+
     /// Calculate the effective ionic strength of the aqueous mixture and its molar derivatives.
     /// @param m The molalities of the aqueous species and their partial derivatives
     /// @return The effective ionic strength of the aqueous mixture and its molar derivatives
     auto effectiveIonicStrength(const ChemicalVector& m) const -> ChemicalScalar;
 
+    /// Calculate the effective ionic strength of the aqueous mixture and its molar derivatives, reusing the memory of a given instance.
+    /// @param[out] Ie The effective ionic strength of the aqueous mixture and its molar derivatives
+    /// @param m The molalities of the aqueous species and their partial derivatives
+    auto effectiveIonicStrength(ChemicalScalar& Ie, const ChemicalVector& m) const -> void;
+
     /// Calculate the stoichiometric ionic strength of the aqueous mixture and its molar derivatives.
     /// @param ms The stoichiometric molalities of the ions and their partial derivatives
     /// @return The stoichiometric ionic strength of the aqueous mixture and its molar derivatives
     auto stoichiometricIonicStrength(const ChemicalVector& ms) const -> ChemicalScalar;
 
+    /// Calculate the stoichiometric ionic strength of the aqueous mixture and its molar derivatives, reusing the memory of a given instance.
+    /// @param[out] Is The stoichiometric ionic strength of the aqueous mixture and its molar derivatives
+    /// @param ms The stoichiometric molalities of the ions and their partial derivatives
+    auto stoichiometricIonicStrength(ChemicalScalar& Is, const ChemicalVector& ms) const -> void;
+
     /// Calculate the state of the aqueous mixture.
     /// @param T The temperature (in units of K)
     /// @param P The pressure (in units of Pa)
     /// @param n The molar amounts of the species in the mixture (in units of mol)
     auto state(Temperature T, Pressure P, VectorConstRef n) const -> AqueousMixtureState;
 
+    /// Calculate the state of the aqueous mixture, reusing the memory of a given instance.
+    /// The aqueous phase calculates its state with this method only once per evaluation of its chemical model.
+    /// @param[out] res The state of the aqueous mixture
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param n The molar amounts of the species in the mixture (in units of mol)
+    auto state(AqueousMixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void;
+
 private:
     /// The index of the water species
     Index idx_water;
@@ -33,10 +33,13 @@ GaseousMixture::~GaseousMixture()
 auto GaseousMixture::state(Temperature T, Pressure P, VectorConstRef n) const -> GaseousMixtureState
 {
     GaseousMixtureState res;
-    res.T = T;
-    res.P = P;
-    res.x = moleFractions(n);
+    state(res, T, P, n);
     return res;
 }
 
+auto GaseousMixture::state(GaseousMixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void
+{
+    GeneralMixture<GaseousSpecies>::state(res, T, P, n);
+}
+
 } // namespace Reaktoro
@@ -52,6 +52,13 @@ public:
     /// @param P The pressure (in units of Pa)
     /// @param n The molar amounts of the species in the mixture (in units of mol)
     auto state(Temperature T, Pressure P, VectorConstRef n) const -> GaseousMixtureState;
+
+    /// Calculate the state of the gaseous mixture, reusing the memory of a given instance.
+    /// @param[out] res The state of the gaseous mixture
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param n The molar amounts of the species in the mixture (in units of mol)
+    auto state(GaseousMixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void;
 };
 
 } // namespace Reaktoro
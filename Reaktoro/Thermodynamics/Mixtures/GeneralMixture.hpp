@@ -106,12 +106,24 @@ public:
     /// @return The mole fractions and their partial derivatives
     auto moleFractions(VectorConstRef n) const -> ChemicalVector;
 
+    /// Calculates the mole fractions of the species and their partial derivatives, reusing the memory of a given instance.
+    /// @param[out] x The mole fractions and their partial derivatives
+    /// @param n The molar abundance of the species (in units of mol)
+    auto moleFractions(ChemicalVector& x, VectorConstRef n) const -> void;
+
     /// Calculate the state of the mixture.
     /// @param T The temperature (in units of K)
     /// @param P The pressure (in units of Pa)
     /// @param n The molar amounts of the species in the mixture (in units of mol)
     auto state(Temperature T, Pressure P, VectorConstRef n) const -> MixtureState;
 
+    /// Calculate the state of the mixture, reusing the memory of a given instance.
+    /// @param[out] res The state of the mixture
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param n The molar amounts of the species in the mixture (in units of mol)
+    auto state(MixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void;
+
 private:
     /// The name of mixture
     std::string _name;
@@ -196,34 +208,46 @@ auto GeneralMixture<SpeciesType>::chargesSpecies() const -> Vector
 
 template<class SpeciesType>
 auto GeneralMixture<SpeciesType>::moleFractions(VectorConstRef n) const -> ChemicalVector
+{
+    ChemicalVector x;
+    moleFractions(x, n);
+    return x;
+}
+
+template<class SpeciesType>
+auto GeneralMixture<SpeciesType>::moleFractions(ChemicalVector& x, VectorConstRef n) const -> void
 {
     const unsigned nspecies = numSpecies();
+    x.resize(nspecies);
     if(nspecies == 1)
     {
-        ChemicalVector x(1);
         x.val[0] = 1.0;
-        return x;
+        return;
     }
-    ChemicalVector x(nspecies);
     const double nt = n.sum();
-    if(nt == 0.0) return x;
+    if(nt == 0.0) return;
     x.val = n/nt;
     for(unsigned i = 0; i < nspecies; ++i)
     {
         x.ddn.row(i).fill(-x.val[i]/nt);
         x.ddn(i, i) += 1.0/nt;
     }
-    return x;
 }
 
 template<class SpeciesType>
 auto GeneralMixture<SpeciesType>::state(Temperature T, Pressure P, VectorConstRef n) const -> MixtureState
 {
     MixtureState res;
+    state(res, T, P, n);
+    return res;
+}
+
+template<class SpeciesType>
+auto GeneralMixture<SpeciesType>::state(MixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void
+{
     res.T = T;
     res.P = P;
-    res.x = moleFractions(n);
-    return res;
+    moleFractions(res.x, n);
 }
 
 } // namespace Reaktoro
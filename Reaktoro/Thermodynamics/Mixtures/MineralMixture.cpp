@@ -37,10 +37,13 @@ MineralMixture::~MineralMixture()
 auto MineralMixture::state(Temperature T, Pressure P, VectorConstRef n) const -> MineralMixtureState
 {
     MineralMixtureState res;
-    res.T = T;
-    res.P = P;
-    res.x = moleFractions(n);
+    state(res, T, P, n);
     return res;
 }
 
+auto MineralMixture::state(MineralMixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void
+{
+    GeneralMixture<MineralSpecies>::state(res, T, P, n);
+}
+
 } // namespace Reaktoro
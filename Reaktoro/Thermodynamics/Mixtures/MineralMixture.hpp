@@ -56,6 +56,13 @@ public:
     /// @param P The pressure (in units of Pa)
     /// @param n The molar amounts of the species in the mixture (in units of mol)
     auto state(Temperature T, Pressure P, VectorConstRef n) const -> MineralMixtureState;
+
+    /// Calculate the state of the mineral mixture, reusing the memory of a given instance.
+    /// @param[out] res The state of the mineral mixture
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param n The molar amounts of the species in the mixture (in units of mol)
+    auto state(MineralMixtureState& res, Temperature T, Pressure P, VectorConstRef n) const -> void;
 };
 
 } // namespace Reaktoro
@@ -28,12 +28,13 @@
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
+#include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelUtils.hpp>
 #include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
 namespace Reaktoro {
 
-auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> PhaseChemicalModel
+auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> AqueousChemicalModel
 {
     // The natural log of 10
     const double ln10 = std::log(10);
@@ -62,115 +63,147 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
     const Vector charges = mixture.chargesChargedSpecies();
 
     // The Debye-Huckel parameters a and b of the charged species
-    std::vector<double> aions, bions;
+    Vector aions(num_charged_species), bions(num_charged_species);
 
     // The Debye-Huckel parameter b of the neutral species
-    std::vector<double> bneutral;
+    Vector bneutral(num_neutral_species);
 
     // Collect the Debye-Huckel parameters a and b of the charged species
-    for(Index i : icharged_species)
+    for(Index i = 0; i < num_charged_species; ++i)
     {
-        const AqueousSpecies& species = mixture.species(i);
-        aions.push_back(params.aion(species.name()));
-        bions.push_back(params.bion(species.name()));
+        const AqueousSpecies& species = mixture.species(icharged_species[i]);
+        aions[i] = params.aion(species.name());
+        bions[i] = params.bion(species.name());
     }
 
     // Collect the Debye-Huckel parameter b of the neutral species
-    for(Index i : ineutral_species)
+    for(Index i = 0; i < num_neutral_species; ++i)
     {
-        const AqueousSpecies& species = mixture.species(i);
-        bneutral.push_back(params.bneutral(species.name()));
+        const AqueousSpecies& species = mixture.species(ineutral_species[i]);
+        bneutral[i] = params.bneutral(species.name());
     }
 
-    // The state of the aqueous mixture
-    AqueousMixtureState state;
+    // The squares of the electrical charges of the charged species
+    const Vector z2 = charges.array().square();
 
-    // Auxiliary variables
-    ChemicalScalar xw, ln_xw, I2, sqrtI, mSigma, sigma(num_species), sigmacoeff, Lambda;
-    ChemicalVector ln_m;
+    // The sum of the parameters b of the charged species divided by their squared charges
+    const double sum_bz2 = (bions.array()/z2.array()).sum();
+
+    // The ln activity coefficients of the solutes and the ln activity of water with derivatives w.r.t. ionic strength and water mole fraction
+    ChemicalVector ln_g(num_species, 2);
+    ChemicalScalar ln_aw(2);
+    Vector ln_aw_m = zeros(num_species);
+
+    // The arrays of the charged species used in the evaluation of the Debye-Huckel model, where
+    // g = A*sqrt(I)/Lambda and x = Lambda - 1, and the suffixes _A, _B, _I, and _x denote partial
+    // derivatives w.r.t. the Debye-Huckel parameters A and B, the ionic strength, and x
+    Vector mions(num_charged_species), x(num_charged_species), Lambda(num_charged_species);
+    Vector g_A(num_charged_species), g_B(num_charged_species), g_I(num_charged_species);
+    Vector f(num_charged_species), f_A(num_charged_species), f_B(num_charged_species), f_I(num_charged_species);
+    Vector sigma(num_charged_species), sigma_x(num_charged_species);
     ThermoScalar A, B, sqrt_rho, T_epsilon, sqrt_T_epsilon;
 
     // Define the intermediate chemical model function of the aqueous mixture
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    AqueousChemicalModel model = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state) mutable
     {
-        // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
+        // Auxiliary reference to the temperature of the mixture
+        const auto& T = state.T;
 
         // Auxiliary constant references
-        const auto& I = state.Ie;            // ionic strength
-        const auto& x = state.x;             // mole fractions of the species
         const auto& m = state.m;             // molalities of the species
+        const auto& I = state.Ie;            // effective ionic strength
         const auto& rho = state.rho/1000;    // density in units of g/cm3
         const auto& epsilon = state.epsilon; // dielectric constant
 
-        // Auxiliary references
-        auto& ln_g = res.ln_activity_coefficients;
-        auto& ln_a = res.ln_activities;
-
-        // Update auxiliary variables
-		ln_m = log(m);
-		xw = x[iwater];
-		ln_xw = log(xw);
-		mSigma = nwo * (1 - xw)/xw;
-		I2 = I*I;
-		sqrtI = sqrt(I);
-		sqrt_rho = sqrt(rho);
-		T_epsilon = T * epsilon;
-		sqrt_T_epsilon = sqrt(T_epsilon);
-		A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
-		B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
-		sigmacoeff = (2.0/3.0)*A*I*sqrtI;
-
-        // Set the first contribution to the activity of water
-        ln_a[iwater] = mSigma;
-
-        // Loop over all charged species in the mixture
-        for(Index i = 0; i < num_charged_species; ++i)
-        {
-            // The index of the current charged species
-            const Index ispecies = icharged_species[i];
-
-            // The molality of the charged species and its molar derivatives
-            const auto mi = m[ispecies];
-
-            // The electrical charge of the charged species
-            const auto z = charges[i];
-
-            // Update the Lambda parameter of the Debye-Huckel activity coefficient model
-            Lambda = 1.0 + aions[i]*B*sqrtI;
-
-			// Update the sigma parameter of the current ion
-            if(aions[i] != 0.0) sigma = 3.0*pow(Lambda - 1, -3) * ((Lambda - 1)*(Lambda - 3) + 2*log(Lambda));
-            else                sigma = 2.0;
+        // The mole fraction of water and its temperature and pressure derivatives
+        const double xw = state.x.val[iwater];
+        const double xw_T = state.x.ddT[iwater];
+        const double xw_P = state.x.ddP[iwater];
 
-            // Calculate the ln activity coefficient of the current charged species
-            ln_g[ispecies] = ln10 * (-A*z*z*sqrtI/Lambda + bions[i]*I);
+        // Update the Debye-Huckel parameters A and B
+        sqrt_rho = sqrt(rho);
+        T_epsilon = T * epsilon;
+        sqrt_T_epsilon = sqrt(T_epsilon);
+        A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
+        B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
 
-            // Calculate the ln activity of the current charged species
-            ln_a[ispecies] = ln_g[ispecies] + ln_m[ispecies];
+        // The square root of the ionic strength and its derivative w.r.t. the ionic strength
+        const double sqrtI = std::sqrt(I.val);
+        const double sqrtI_I = 0.5/sqrtI;
 
-            // Calculate the contribution of current ion to the ln activity of water
-			ln_a[iwater] += mi*ln_g[ispecies] + sigmacoeff*sigma*ln10 - I2*bions[i]/(z*z)*ln10;
+        // Gather the molalities of the charged species
+        for(Index i = 0; i < num_charged_species; ++i)
+            mions[i] = m.val[icharged_species[i]];
+
+        // Evaluate the ln activity coefficients of all charged species at once, as
+        // ln(g) = ln(10)*(-A*z*z*sqrt(I)/Lambda + b*I), with Lambda = 1 + a*B*sqrt(I)
+        x = aions * (B.val*sqrtI);
+        Lambda = 1.0 + x.array();
+        g_A = sqrtI/Lambda.array();
+        g_B = -A.val*I.val * aions.array()/Lambda.array().square();
+        g_I = A.val*sqrtI_I/Lambda.array().square();
+        f = ln10 * (-A.val*z2.array()*g_A.array() + bions.array()*I.val);
+        f_A = -ln10 * z2.array()*g_A.array();
+        f_B = -ln10 * z2.array()*g_B.array();
+        f_I = ln10 * (-z2.array()*g_I.array() + bions.array());
+
+        // Evaluate the sigma function of all charged species at once, as
+        // sigma = 3/x^3*(x*(x - 2) + 2*ln(1 + x)), which is 2 for ions with a = 0
+        sigma = (aions.array() != 0.0).select(3.0/x.array().cube() * (x.array()*(x.array() - 2.0) + 2.0*Lambda.array().log()), 2.0);
+        sigma_x = (aions.array() != 0.0).select(6.0/(x.array()*Lambda.array()) - 3.0*sigma.array()/x.array(), 0.0);
+
+        // Scatter the ln activity coefficients of the charged species and their derivatives
+        for(Index i = 0; i < num_charged_species; ++i)
+        {
+            const Index ispecies = icharged_species[i];
+            ln_g.val[ispecies] = f[i];
+            ln_g.ddT[ispecies] = f_A[i]*A.ddT + f_B[i]*B.ddT + f_I[i]*I.ddT;
+            ln_g.ddP[ispecies] = f_A[i]*A.ddP + f_B[i]*B.ddP + f_I[i]*I.ddP;
+            ln_g.ddn(ispecies, 0) = f_I[i];
+            ln_g.ddn(ispecies, 1) = 0.0;
+            ln_aw_m[ispecies] = -1.0/nwo * f[i];
         }
 
-        // Finalize the computation of the activity of water (in mole fraction scale)
-        ln_a[iwater] *= -1.0/nwo;
-
-        // Set the activity coefficient of water (mole fraction scale)
-        ln_g[iwater] = ln_a[iwater] - ln_xw;
-
-        // Loop over all neutral species in the mixture
+        // The sums over the charged species of the sigma function and its derivatives w.r.t. B and I
+        const double sum_sigma = sigma.sum();
+        const double sum_sigma_B = sqrtI * sigma_x.dot(aions);
+        const double sum_sigma_I = B.val*sqrtI_I * sigma_x.dot(aions);
+
+        // The coefficient of the sigma function, (2/3)*A*I*sqrt(I), and its derivatives w.r.t. A and I
+        const double sigmacoeff = (2.0/3.0)*A.val*I.val*sqrtI;
+        const double sigmacoeff_A = (2.0/3.0)*I.val*sqrtI;
+        const double sigmacoeff_I = A.val*sqrtI;
+
+        // The contribution of the mole fraction of water to the ln activity of water and its derivative
+        const double mSigma = nwo * (1 - xw)/xw;
+        const double mSigma_xw = -nwo/(xw*xw);
+
+        // Calculate the ln activity of water (in mole fraction scale) and its partial derivatives, which is
+        // -1/nwo*(mSigma + sum(m*ln(g)) + ln(10)*sigmacoeff*sum(sigma) - ln(10)*I*I*sum(b/z^2))
+        const double L = mSigma + mions.dot(f) + ln10*sigmacoeff*sum_sigma - ln10*I.val*I.val*sum_bz2;
+        const double L_A = mions.dot(f_A) + ln10*sigmacoeff_A*sum_sigma;
+        const double L_B = mions.dot(f_B) + ln10*sigmacoeff*sum_sigma_B;
+        const double L_I = mions.dot(f_I) + ln10*(sigmacoeff_I*sum_sigma + sigmacoeff*sum_sigma_I) - 2*ln10*I.val*sum_bz2;
+
+        ln_aw.val = -1.0/nwo * L;
+        ln_aw.ddT = -1.0/nwo * (L_A*A.ddT + L_B*B.ddT + L_I*I.ddT + mSigma_xw*xw_T);
+        ln_aw.ddP = -1.0/nwo * (L_A*A.ddP + L_B*B.ddP + L_I*I.ddP + mSigma_xw*xw_P);
+        ln_aw.ddn[0] = -1.0/nwo * L_I;
+        ln_aw.ddn[1] = -1.0/nwo * mSigma_xw;
+
+        // Calculate the ln activity coefficients of the neutral species
         for(Index i = 0; i < num_neutral_species; ++i)
         {
-            // The index of the current neutral species
             const Index ispecies = ineutral_species[i];
-
-            // Calculate the ln activity coefficient of the current neutral species
-            ln_g[ispecies] = ln10 * bneutral[i] * I;
-
-            // Calculate the ln activity coefficient of the current neutral species
-            ln_a[ispecies] = ln_g[ispecies] + ln_m[ispecies];
+            ln_g.val[ispecies] = ln10 * bneutral[i] * I.val;
+            ln_g.ddT[ispecies] = ln10 * bneutral[i] * I.ddT;
+            ln_g.ddP[ispecies] = ln10 * bneutral[i] * I.ddP;
+            ln_g.ddn(ispecies, 0) = ln10 * bneutral[i];
+            ln_g.ddn(ispecies, 1) = 0.0;
         }
+
+        // Set the activities of the solutes (molality scale) and water (mole fraction scale)
+        setAqueousLnActivitiesDiagonalLowRank(res, state, iwater, ln_g, ln_aw, ln_aw_m);
     };
 
     return model;
@@ -34,8 +34,8 @@ class DebyeHuckelParams;
 /// @param mixture The aqueous mixture instance
 /// @param params The parameters for the Debye--Hückel activity model.
 /// @return The activity model function for the aqueous phase
-/// @see AqueousMixture, DebyeHuckelParams, PhaseChemicalModel
-auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> PhaseChemicalModel;
+/// @see AqueousMixture, DebyeHuckelParams, AqueousChemicalModel
+auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> AqueousChemicalModel;
 
 /**
 A class used to define the parameters in the Debye--Hückel activity model for aqueous mixtures.
@@ -28,6 +28,7 @@
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
+#include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelUtils.hpp>
 #include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
@@ -286,7 +287,7 @@ auto effectiveIonicRadius(const AqueousSpecies& species) -> double
 
 } // namespace
 
-auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalModel
+auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> AqueousChemicalModel
 {
     // The number of species in the mixture
     const unsigned num_species = mixture.numSpecies();
@@ -315,9 +316,6 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
     // The molar mass of water
     const double Mw = waterMolarMass;
 
-    // The state of the aqueous mixture
-    AqueousMixtureState state;
-
     // Collect the effective radii of the ions
     for(Index idx_ion : icharged_species)
     {
@@ -326,23 +324,29 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
         charges.push_back(species.charge());
     }
 
+    // The ln activity coefficients of the solutes with derivatives w.r.t. ionic strength and water mole fraction
+    ChemicalVector ln_g(num_species, 2);
+
+    // The derivatives of the ln activity of water w.r.t. the molalities of the solutes
+    Vector ln_aw_m(num_species);
+
     // Define the chemical model function of the aqueous phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    AqueousChemicalModel model = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state) mutable
     {
-        // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
+        // Auxiliary references to the temperature and pressure of the mixture
+        const auto& T = state.T;
+        const auto& P = state.P;
 
         // Auxiliary references to state variables
-        const auto& I = state.Ie;
-        const auto& x = state.x;
         const auto& m = state.m;
 
+        // The ionic strength and the mole fraction of the water species with derivatives w.r.t. themselves
+        ChemicalScalar I, xw;
+        std::tie(I, xw) = aqueousReducedIonicStrengthAndWaterMoleFraction(state, iwater);
+
         // The square root of the ionic strength
         const auto sqrtI = sqrt(I);
 
-        // The mole fraction of the water species and its molar derivatives
-        const auto xw = x[iwater];
-
         // The ln and log10 of water mole fraction
         const auto ln_xw = log(xw);
         const auto log10_xw = log10(xw);
@@ -357,12 +361,15 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
         const double bNapClm = shortRangeInteractionParamNaCl(T.val, P.val);
 
         // The osmotic coefficient of the aqueous phase
-        ChemicalScalar phi(num_species);
+        ChemicalScalar phi(2);
 
         // Set the activity coefficients of the neutral species to
         // water mole fraction to convert it to molality scale
-        res.ln_activity_coefficients = 0.0;
-//        res.ln_activity_coefficients = ln_xw;
+        ln_g = 0.0;
+//        ln_g = ln_xw;
+
+        // The direct dependence of the activity of water on the molalities of the solutes
+        ln_aw_m.fill(0.0);
 
         // Loop over all charged species in the mixture
         for(unsigned i = 0; i < num_charged_species; ++i)
@@ -370,11 +377,11 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
             // The index of the charged species in the mixture
             const Index ispecies = icharged_species[i];
 
-            // The molality of the charged species and its molar derivatives
-            const auto mi = m[ispecies];
+            // The molality of the charged species
+            const double mi = m.val[ispecies];
 
             // Check if the molality of the charged species is zero
-            if(mi.val == 0.0)
+            if(mi == 0.0)
                 continue;
 
             // The electrical charge of the charged species
@@ -403,7 +410,7 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
             const ChemicalScalar log10_gi = -(A*z2*sqrtI)/lambda + log10_xw + (omega_abs * bNaCl + bNapClm - 0.19*(std::abs(z) - 1.0)) * I;
 
             // Set the activity coefficient of the current charged species
-            res.ln_activity_coefficients[ispecies] = log10_gi * ln10;
+            ln_g[ispecies] = log10_gi * ln10;
 
             // Check if the mole fraction of water is one
             if(xw != 1.0)
@@ -416,18 +423,13 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
 
                 // Update the osmotic coefficient with the contribution of the current charged species
                 phi += mi * psi;
+                ln_aw_m[ispecies] = ln10 * Mw * psi.val;
             }
         }
 
-        // Set the activities of the solutes (molality scale)
-        res.ln_activities = res.ln_activity_coefficients + log(m);
-
-        // Set the activity of water (in mole fraction scale)
-        if(xw != 1.0) res.ln_activities[iwater] = ln10 * Mw * phi;
-                 else res.ln_activities[iwater] = ln_xw;
-
-        // Set the activity coefficient of water (mole fraction scale)
-        res.ln_activity_coefficients[iwater] = res.ln_activities[iwater] - ln_xw;
+        // Set the activities of the solutes (molality scale) and water (mole fraction scale)
+        if(xw != 1.0) setAqueousLnActivitiesDiagonalLowRank(res, state, iwater, ln_g, ln10 * Mw * phi, ln_aw_m);
+                 else setAqueousLnActivitiesDiagonalLowRank(res, state, iwater, ln_g, ln_xw, ln_aw_m);
     };
 
     return model;
@@ -19,31 +19,34 @@
 
 // Reaktoro includes
 #include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
+#include <Reaktoro/Thermodynamics/Models/AqueousChemicalModelUtils.hpp>
 
 namespace Reaktoro {
 
-auto aqueousChemicalModelIdeal(const AqueousMixture& mixture) -> PhaseChemicalModel
+auto aqueousChemicalModelIdeal(const AqueousMixture& mixture) -> AqueousChemicalModel
 {
     const Index iH2O = mixture.indexWater();
 
-    // The state of the aqueous mixture
-    AqueousMixtureState state;
+    // The number of species in the mixture
+    const Index num_species = mixture.numSpecies();
 
-    PhaseChemicalModel f = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    // The ln activity coefficients of the solutes with derivatives w.r.t. ionic strength and water mole fraction
+    ChemicalVector ln_g(num_species, 2);
+
+    // The derivatives of the ln activity of water w.r.t. the molalities of the solutes
+    const Vector ln_aw_m = zeros(num_species);
+
+    AqueousChemicalModel f = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state) mutable
     {
-        // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
+        // The water mole fraction with derivatives w.r.t. ionic strength and water mole fraction
+        const ChemicalScalar xw = std::get<1>(aqueousReducedIonicStrengthAndWaterMoleFraction(state, iH2O));
 
         // The ln of water mole fraction
-        ChemicalScalar ln_xw = log(state.x[iH2O]);
-
-        // Set the activity coefficients of the aqueous species
-        res.ln_activity_coefficients = ln_xw;
-        res.ln_activity_coefficients[iH2O] = 0.0;
+        const ChemicalScalar ln_xw = log(xw);
 
-        // Set the activities of the aqueous species
-        res.ln_activities = res.ln_activity_coefficients + log(state.m);
-        res.ln_activities[iH2O] = ln_xw;
+        // Set the activity coefficients of the solutes and the activities of all aqueous species
+        ln_g = ln_xw;
+        setAqueousLnActivitiesDiagonalLowRank(res, state, iH2O, ln_g, ln_xw, ln_aw_m);
     };
 
     return f;
@@ -0,0 +1,120 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "AqueousChemicalModelUtils.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
+
+namespace Reaktoro {
+
+auto aqueousReducedIonicStrengthAndWaterMoleFraction(const AqueousMixtureState& state, Index iwater) -> std::tuple<ChemicalScalar, ChemicalScalar>
+{
+    const auto& I = state.Ie;
+    const auto xw = state.x[iwater];
+    ChemicalScalar Ir(I.val, I.ddT, I.ddP, RowVector::Unit(2, 0));
+    ChemicalScalar xwr(xw.val, xw.ddT, xw.ddP, RowVector::Unit(2, 1));
+    return std::make_tuple(Ir, xwr);
+}
+
+auto setAqueousLnActivitiesDiagonalLowRank(PhaseChemicalModelResult& res, const AqueousMixtureState& state, Index iwater,
+    const ChemicalVector& ln_g, const ChemicalScalar& ln_aw, VectorConstRef ln_aw_m) -> void
+{
+    // Auxiliary references to state variables
+    const auto& I = state.Ie;
+    const auto& m = state.m;
+    const auto xw = state.x[iwater];
+
+    // The number of species in the aqueous phase
+    const Index nspecies = m.size();
+
+    // Auxiliary references to the diagonal and low-rank factors of the molar derivatives of the ln activities
+    auto& D = res.ln_activities_lowrank.D;
+    auto& U = res.ln_activities_lowrank.U;
+    auto& V = res.ln_activities_lowrank.V;
+
+    // The columns of the low-rank factors are the dependence of the ln activities on
+    // (0) the amount of water through the molalities of the solutes,
+    // (1) the effective ionic strength,
+    // (2) the mole fraction of water, and
+    // (3) the molalities of the solutes through the ln activity of water
+    D.resize(nspecies);
+    U.setZero(nspecies, 4);
+    V.setZero(nspecies, 4);
+    V(iwater, 0) = 1.0;
+    V.col(1) = tr(I.ddn);
+    V.col(2) = tr(xw.ddn);
+
+    // Set the ln activities and ln activity coefficients of the solutes
+    for(Index i = 0; i < nspecies; ++i)
+    {
+        if(i == iwater) continue;
+
+        // The molar derivatives of the ln molality of the solute are nonzero only w.r.t. itself and water
+        D[i] = m.ddn(i, i)/m.val[i];
+        U(i, 0) = m.ddn(i, iwater)/m.val[i];
+        U(i, 1) = ln_g.ddn(i, 0);
+        U(i, 2) = ln_g.ddn(i, 1);
+
+        // The direct dependence of the ln activity of water on the molality of the solute
+        V(i, 3) = ln_aw_m[i] * m.ddn(i, i);
+        U(iwater, 0) += ln_aw_m[i] * m.ddn(i, iwater);
+
+        res.ln_activity_coefficients.val[i] = ln_g.val[i];
+        res.ln_activity_coefficients.ddT[i] = ln_g.ddT[i];
+        res.ln_activity_coefficients.ddP[i] = ln_g.ddP[i];
+
+        res.ln_activities.val[i] = ln_g.val[i] + std::log(m.val[i]);
+        res.ln_activities.ddT[i] = ln_g.ddT[i];
+        res.ln_activities.ddP[i] = ln_g.ddP[i];
+    }
+
+    // Set the ln activity and ln activity coefficient of water (mole fraction scale)
+    D[iwater] = 0.0;
+    U(iwater, 1) = ln_aw.ddn[0];
+    U(iwater, 2) = ln_aw.ddn[1];
+    U(iwater, 3) = 1.0;
+
+    res.ln_activities.val[iwater] = ln_aw.val;
+    res.ln_activities.ddT[iwater] = ln_aw.ddT;
+    res.ln_activities.ddP[iwater] = ln_aw.ddP;
+
+    res.ln_activity_coefficients.val[iwater] = ln_aw.val - std::log(xw.val);
+    res.ln_activity_coefficients.ddT[iwater] = ln_aw.ddT;
+    res.ln_activity_coefficients.ddP[iwater] = ln_aw.ddP;
+
+    // Assemble the dense molar derivatives of the ln activity coefficients and ln activities in one pass over their
+    // columns. Only the columns (1) and (2) of the low-rank factors are dense: column (0) of V and column (3) of U
+    // are nonzero only for water, so they contribute only to the column and the row of water, respectively.
+    for(Index j = 0; j < nspecies; ++j)
+    {
+        res.ln_activity_coefficients.ddn.col(j).noalias() = U.col(1)*V(j, 1) + U.col(2)*V(j, 2);
+        res.ln_activity_coefficients.ddn(iwater, j) += V(j, 3);
+        res.ln_activities.ddn.col(j) = res.ln_activity_coefficients.ddn.col(j);
+        res.ln_activities.ddn(j, j) += D[j];
+    }
+
+    // Add the dependence on the amount of water through the molalities of the solutes, which
+    // the ln activity coefficients of the solutes exclude
+    res.ln_activities.ddn.col(iwater) += U.col(0);
+    res.ln_activity_coefficients.ddn(iwater, iwater) += U(iwater, 0);
+
+    // Remove the contribution of the ln mole fraction of water from the ln activity coefficient of water
+    res.ln_activity_coefficients.ddn.row(iwater) -= xw.ddn/xw.val;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,54 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <tuple>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Thermodynamics/Models/PhaseChemicalModel.hpp>
+
+namespace Reaktoro {
+
+/// Return the effective ionic strength and the mole fraction of water of an aqueous mixture with reduced derivatives.
+/// The returned chemical scalars have the same values and temperature and pressure derivatives as `state.Ie` and
+/// `state.x[iwater]`, but their derivatives `ddn` are taken with respect to these two quantities, in this order,
+/// instead of the amounts of the species. Aqueous chemical models whose activity coefficients depend on the
+/// composition only through these two quantities evaluate their formulas with them, which avoids the calculation
+/// of a dense matrix of molar derivatives per species (see setAqueousLnActivitiesDiagonalLowRank).
+/// @param state The state of the aqueous mixture
+/// @param iwater The index of water in the aqueous mixture
+auto aqueousReducedIonicStrengthAndWaterMoleFraction(const AqueousMixtureState& state, Index iwater) -> std::tuple<ChemicalScalar, ChemicalScalar>;
+
+/// Set the ln activities and ln activity coefficients of the species in an aqueous phase from their reduced derivatives.
+/// The ln activity coefficients of the solutes and the ln activity of water are given with derivatives with respect to
+/// the effective ionic strength and the mole fraction of water (see aqueousReducedIonicStrengthAndWaterMoleFraction).
+/// The ln activity of water can also depend directly on the molalities of the solutes. This method sets the molar
+/// derivatives of the ln activities as a diagonal plus a low-rank matrix in `res.ln_activities_lowrank`, and
+/// assembles from it the dense molar derivatives of the ln activities and the ln activity coefficients.
+/// @param res The chemical properties of the aqueous phase
+/// @param state The state of the aqueous mixture
+/// @param iwater The index of water in the aqueous mixture
+/// @param ln_g The ln activity coefficients of the solutes with reduced derivatives (the entry of water is ignored)
+/// @param ln_aw The ln activity of water with reduced derivatives
+/// @param ln_aw_m The partial derivatives of the ln activity of water with respect to the molalities of the solutes
+auto setAqueousLnActivitiesDiagonalLowRank(PhaseChemicalModelResult& res, const AqueousMixtureState& state, Index iwater,
+    const ChemicalVector& ln_g, const ChemicalScalar& ln_aw, VectorConstRef ln_aw_m) -> void;
+
+} // namespace Reaktoro
@@ -29,7 +29,8 @@ ChemicalModelResult::ChemicalModelResult(Index nphases, Index nspecies)
   phase_residual_molar_gibbs_energies(nphases, nspecies),
   phase_residual_molar_enthalpies(nphases, nspecies),
   phase_residual_molar_heat_capacities_cp(nphases, nspecies),
-  phase_residual_molar_heat_capacities_cv(nphases, nspecies)
+  phase_residual_molar_heat_capacities_cv(nphases, nspecies),
+  phase_ln_activities_lowrank(nphases)
 {}
 
 auto ChemicalModelResult::resize(Index nphases, Index nspecies) -> void
@@ -41,6 +42,7 @@ auto ChemicalModelResult::resize(Index nphases, Index nspecies) -> void
     phase_residual_molar_enthalpies.resize(nphases, nspecies);
     phase_residual_molar_heat_capacities_cp.resize(nphases, nspecies);
     phase_residual_molar_heat_capacities_cv.resize(nphases, nspecies);
+    phase_ln_activities_lowrank.resize(nphases);
 }
 
 auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index nspecies) -> PhaseChemicalModelResult
@@ -52,7 +54,8 @@ auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index ns
         row(phase_residual_molar_gibbs_energies, iphase, ispecies, nspecies),
         row(phase_residual_molar_enthalpies, iphase, ispecies, nspecies),
         row(phase_residual_molar_heat_capacities_cp, iphase, ispecies, nspecies),
-        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies)
+        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies),
+        phase_ln_activities_lowrank[iphase]
     };
 }
 
@@ -65,7 +68,8 @@ auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index ns
         row(phase_residual_molar_gibbs_energies, iphase, ispecies, nspecies),
         row(phase_residual_molar_enthalpies, iphase, ispecies, nspecies),
         row(phase_residual_molar_heat_capacities_cp, iphase, ispecies, nspecies),
-        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies)
+        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies),
+        phase_ln_activities_lowrank[iphase]
     };
 }
 
@@ -96,6 +96,11 @@ public:
     /// Return the residual molar isochoric heat capacities of the phases w.r.t. to its ideal state (in units of J/(mol*K)).
     inline auto phaseResidualMolarHeatCapacitiesCv() const -> ChemicalVectorConstRef { return phase_residual_molar_heat_capacities_cv; }
 
+    /// Return the molar derivatives of the ln activities of the species in a phase represented as a diagonal plus a low-rank matrix.
+    /// The diagonal `D` of the returned matrix is empty if the chemical model of the phase does not provide this representation.
+    /// @param iphase The index of the phase.
+    inline auto phaseLnActivitiesLowRank(Index iphase) const -> const DiagonalLowRankMatrix& { return phase_ln_activities_lowrank[iphase]; }
+
 private:
     /// The natural log of the activity coefficients of the species.
     ChemicalVector ln_activity_coefficients;
@@ -117,6 +122,9 @@ private:
 
     /// The residual molar isochoric heat capacities of the phases w.r.t. to its ideal state (in units of J/(mol*K)).
     ChemicalVector phase_residual_molar_heat_capacities_cv;
+
+    /// The molar derivatives of the ln activities of the species in each phase represented as a diagonal plus a low-rank matrix.
+    std::vector<DiagonalLowRankMatrix> phase_ln_activities_lowrank;
 };
 
 /// The signature of the chemical model function that calculates the chemical properties of the species in a chemical system.
@@ -28,7 +28,7 @@
 namespace Reaktoro {
 namespace {
 
-auto gaseousChemicalModelCubicEOS(const GaseousMixture& mixture, CubicEOS::Model modeltype) -> PhaseChemicalModel
+auto gaseousChemicalModelCubicEOS(const GaseousMixture& mixture, CubicEOS::Model modeltype) -> GaseousChemicalModel
 {
     // The number of gases in the mixture
     const unsigned nspecies = mixture.numSpecies();
@@ -50,14 +50,12 @@ auto gaseousChemicalModelCubicEOS(const GaseousMixture& mixture, CubicEOS::Model
     eos.setAcentricFactors(omega);
     eos.setModel(modeltype);
 
-    // The state of the gaseous mixture
-    GaseousMixtureState state;
-
     // Define the chemical model function of the gaseous phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    GaseousChemicalModel model = [=](PhaseChemicalModelResult& res, const GaseousMixtureState& state) mutable
     {
-        // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        // Auxiliary references to the temperature and pressure of the mixture
+        const auto& T = state.T;
+        const auto& P = state.P;
 
         // The mole fractions of the species
         const auto& x = state.x;
@@ -89,22 +87,22 @@ auto gaseousChemicalModelCubicEOS(const GaseousMixture& mixture, CubicEOS::Model
 
 } // namespace
 
-auto gaseousChemicalModelVanDerWaals(const GaseousMixture& mixture) -> PhaseChemicalModel
+auto gaseousChemicalModelVanDerWaals(const GaseousMixture& mixture) -> GaseousChemicalModel
 {
     return gaseousChemicalModelCubicEOS(mixture, CubicEOS::VanDerWaals);
 }
 
-auto gaseousChemicalModelRedlichKwong(const GaseousMixture& mixture) -> PhaseChemicalModel
+auto gaseousChemicalModelRedlichKwong(const GaseousMixture& mixture) -> GaseousChemicalModel
 {
     return gaseousChemicalModelCubicEOS(mixture, CubicEOS::RedlichKwong);
 }
 
-auto gaseousChemicalModelSoaveRedlichKwong(const GaseousMixture& mixture) -> PhaseChemicalModel
+auto gaseousChemicalModelSoaveRedlichKwong(const GaseousMixture& mixture) -> GaseousChemicalModel
 {
     return gaseousChemicalModelCubicEOS(mixture, CubicEOS::SoaveRedlichKwong);
 }
 
-auto gaseousChemicalModelPengRobinson(const GaseousMixture& mixture) -> PhaseChemicalModel
+auto gaseousChemicalModelPengRobinson(const GaseousMixture& mixture) -> GaseousChemicalModel
 {
     return gaseousChemicalModelCubicEOS(mixture, CubicEOS::PengRobinson);
 }
@@ -23,16 +23,13 @@
 
 namespace Reaktoro {
 
-auto gaseousChemicalModelIdeal(const GaseousMixture& mixture) -> PhaseChemicalModel
+auto gaseousChemicalModelIdeal(const GaseousMixture& mixture) -> GaseousChemicalModel
 {
-    // The state of the gaseous mixture
-    GaseousMixtureState state;
-
     // Define the chemical model function of the gaseous phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    GaseousChemicalModel model = [=](PhaseChemicalModelResult& res, const GaseousMixtureState& state) mutable
     {
-        // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        // Auxiliary reference to the pressure of the mixture
+        const auto& P = state.P;
 
         // Calculate pressure in bar
         const ThermoScalar Pbar = 1e-5 * Pressure(P);
@@ -29,6 +29,6 @@ class GaseousMixture;
 /// @param mixture The gaseous mixture
 /// @return The equation of state function for the gaseous phase
 /// @see GaseousMixture, GaseousChemicalModel
-auto gaseousChemicalModelIdeal(const GaseousMixture& mixture) -> PhaseChemicalModel;
+auto gaseousChemicalModelIdeal(const GaseousMixture& mixture) -> GaseousChemicalModel;
 
 } // namespace Reaktoro
@@ -85,7 +85,7 @@ auto volumeCO2(Temperature T, ThermoScalar Pb, ThermoScalar sqrtT) -> ThermoScal
 
 } // namespace
 
-auto gaseousChemicalModelSpycherPruessEnnis(const GaseousMixture& mixture) -> PhaseChemicalModel
+auto gaseousChemicalModelSpycherPruessEnnis(const GaseousMixture& mixture) -> GaseousChemicalModel
 {
     // The index of the species H2O(g) in the gaseous mixture
     const Index iH2O = mixture.indexSpecies("H2O(g)");
@@ -100,14 +100,12 @@ auto gaseousChemicalModelSpycherPruessEnnis(const GaseousMixture& mixture) -> Ph
     ChemicalScalar ln_xH2O(nspecies);
     ChemicalScalar ln_xCO2(nspecies);
 
-    // The state of the gaseous mixture
-    GaseousMixtureState state;
-
     // Define the chemical model function of the gaseous phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    GaseousChemicalModel model = [=](PhaseChemicalModelResult& res, const GaseousMixtureState& state) mutable
     {
-        // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        // Auxiliary references to the temperature and pressure of the mixture
+        const auto& T = state.T;
+        const auto& P = state.P;
 
         // Calculate the pressure in bar
         const auto Pb = convertPascalToBar(P);
@@ -197,7 +197,7 @@ inline auto computeCTT(const ThermoScalar& T, int i, int j, int k) -> ThermoScal
 
 } // namespace
 
-auto gaseousChemicalModelSpycherReed(const GaseousMixture& mixture) -> PhaseChemicalModel
+auto gaseousChemicalModelSpycherReed(const GaseousMixture& mixture) -> GaseousChemicalModel
 {
     // The names of the gases in the mixture, and the supported ones by this model
     std::vector<std::string> provided = names(mixture.species());
@@ -234,14 +234,12 @@ auto gaseousChemicalModelSpycherReed(const GaseousMixture& mixture) -> PhaseChem
     // The universal gas constant of the phase (in units of J/(mol*K))
     const double R = universalGasConstant;
 
-    // The state of the gaseous mixture
-    GaseousMixtureState state;
-
     // Define the chemical model function of the gaseous phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    GaseousChemicalModel model = [=](PhaseChemicalModelResult& res, const GaseousMixtureState& state) mutable
     {
-        // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        // Auxiliary references to the temperature and pressure of the mixture
+        const auto& T = state.T;
+        const auto& P = state.P;
 
         // The mole fractions of the species
         const auto& x = state.x;
@@ -22,17 +22,11 @@
 
 namespace Reaktoro {
 
-auto mineralChemicalModelIdeal(const MineralMixture& mixture) -> PhaseChemicalModel
+auto mineralChemicalModelIdeal(const MineralMixture& mixture) -> MineralChemicalModel
 {
-    // The state of the mineral mixture
-    MineralMixtureState state;
-
     // Define the chemical model function of the mineral phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    MineralChemicalModel model = [=](PhaseChemicalModelResult& res, const MineralMixtureState& state) mutable
     {
-        // Evaluate the state of the mineral mixture
-        state = mixture.state(T, P, n);
-
         // Fill the chemical properties of the mineral phase
         res.ln_activities = log(state.x);
     };
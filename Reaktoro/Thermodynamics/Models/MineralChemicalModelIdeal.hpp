@@ -29,6 +29,6 @@ class MineralMixture;
 /// @param mixture The mineral mixture
 /// @return The equation of state function for the mineral phase
 /// @see MineralMixture, MineralChemicalModel
-auto mineralChemicalModelIdeal(const MineralMixture& mixture) -> PhaseChemicalModel;
+auto mineralChemicalModelIdeal(const MineralMixture& mixture) -> MineralChemicalModel;
 
 } // namespace Reaktoro
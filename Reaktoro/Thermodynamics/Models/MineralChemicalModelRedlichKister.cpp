@@ -23,21 +23,15 @@
 
 namespace Reaktoro {
 
-auto mineralChemicalModelRedlichKister(const MineralMixture& mixture, double a0, double a1, double a2) -> PhaseChemicalModel
+auto mineralChemicalModelRedlichKister(const MineralMixture& mixture, double a0, double a1, double a2) -> MineralChemicalModel
 {
     Assert(mixture.numSpecies() == 2,
         "Cannot create the chemical model Redlich-Kister for the mineral phase.",
         "The Redlich-Kister model requires a solid solution phase with two species.");
 
-    // The state of the mineral mixture
-    MineralMixtureState state;
-
     // Define the chemical model function of the mineral phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    MineralChemicalModel model = [=](PhaseChemicalModelResult& res, const MineralMixtureState& state) mutable
     {
-        // Evaluate the state of the mineral mixture
-        state = mixture.state(T, P, n);
-
         const auto RT = universalGasConstant * state.T;
 
         const auto x1 = state.x[0];
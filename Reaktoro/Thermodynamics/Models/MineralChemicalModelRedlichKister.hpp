@@ -39,6 +39,6 @@ class MineralMixture;
 /// @param a2 The Redlich-Kister parameter a2
 /// @return The equation of state function for the mineral phase
 /// @see MineralMixture, MineralChemicalModel
-auto mineralChemicalModelRedlichKister(const MineralMixture& mixture, double a0, double a1, double a2) -> PhaseChemicalModel;
+auto mineralChemicalModelRedlichKister(const MineralMixture& mixture, double a0, double a1, double a2) -> MineralChemicalModel;
 
 } // namespace Reaktoro
@@ -24,11 +24,17 @@
 #include <Reaktoro/Common/ThermoScalar.hpp>
 #include <Reaktoro/Common/ChemicalScalar.hpp>
 #include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Math/DiagonalLowRankMatrix.hpp>
 
 namespace Reaktoro {
 
+// Forward declarations
+struct AqueousMixtureState;
+struct GaseousMixtureState;
+struct MineralMixtureState;
+
 /// The result of a chemical model function that calculates the chemical properties of species.
-template<typename ScalarType, typename VectorType>
+template<typename ScalarType, typename VectorType, typename LowRankType>
 struct PhaseChemicalModelResultBase
 {
     /// The natural log of the activity coefficients of the species in the phase.
@@ -51,15 +57,32 @@ struct PhaseChemicalModelResultBase
 
     /// The residual molar isochoric heat capacity of the phase w.r.t. to its ideal state (in units of J/(mol*K)).
     ScalarType residual_molar_heat_capacity_cv;
+
+    /// The molar derivatives of the ln activities of the species in the phase represented as `diag(D) + U*tr(V)`.
+    /// This is an optional representation of `ln_activities.ddn`, which the chemical model of the phase provides
+    /// when the activity coefficients depend on the composition only through a few quantities (e.g., the ionic strength).
+    /// Chemical models that do not provide it leave `D` empty.
+    LowRankType ln_activities_lowrank;
 };
 
 /// The chemical properties of the species in a phase.
-using PhaseChemicalModelResult = PhaseChemicalModelResultBase<ChemicalScalarRef, ChemicalVectorRef>;
+using PhaseChemicalModelResult = PhaseChemicalModelResultBase<ChemicalScalarRef, ChemicalVectorRef, DiagonalLowRankMatrix&>;
 
 /// The chemical properties of the species in a phase (constant).
-using PhaseChemicalModelResultConst = PhaseChemicalModelResultBase<ChemicalScalarConstRef, ChemicalVectorConstRef>;
+using PhaseChemicalModelResultConst = PhaseChemicalModelResultBase<ChemicalScalarConstRef, ChemicalVectorConstRef, const DiagonalLowRankMatrix&>;
 
 /// The signature of the chemical model function that calculates the chemical properties of the species in a phase.
 using PhaseChemicalModel = std::function<void(PhaseChemicalModelResult&, Temperature, Pressure, VectorConstRef)>;
 
+/// The signature of the chemical model function that calculates the chemical properties of the species in an aqueous phase.
+/// The state of the aqueous mixture is calculated by the phase only once per evaluation, and then shared by its chemical
+/// model and the activity models of its species (see AqueousPhase).
+using AqueousChemicalModel = std::function<void(PhaseChemicalModelResult&, const AqueousMixtureState&)>;
+
+/// The signature of the chemical model function that calculates the chemical properties of the species in a gaseous phase.
+using GaseousChemicalModel = std::function<void(PhaseChemicalModelResult&, const GaseousMixtureState&)>;
+
+/// The signature of the chemical model function that calculates the chemical properties of the species in a mineral phase.
+using MineralChemicalModel = std::function<void(PhaseChemicalModelResult&, const MineralMixtureState&)>;
+
 } // namespace Reaktoro
@@ -39,7 +39,7 @@ struct AqueousPhase::Impl
     AqueousMixture mixture;
 
     /// The base chemical model of the phase (yet to be combined with the custom activity coefficient models below)
-    PhaseChemicalModel base_model;
+    AqueousChemicalModel base_model;
 
     /// The functions that calculate the ln activity coefficients of selected species
     std::map<Index, AqueousActivityModel> ln_activity_coeff_functions;
@@ -65,18 +65,18 @@ struct AqueousPhase::Impl
         // Create a copy of the data member `ln_activity_coeff_functions` to be used in the following lambda function
         auto ln_activity_coeff_functions = this->ln_activity_coeff_functions;
 
-        // The state of the aqueous mixture
+        // The state of the aqueous mixture, whose memory is reused in every evaluation of the model below
         AqueousMixtureState state;
 
         // Define the function that calculates the chemical properties of the phase
         PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
         {
-            // Evaluate the state of the aqueous mixture
-            state = mixture.state(T, P, n);
+            // Evaluate the state of the aqueous mixture only once, for both the base model and the activity models below
+            mixture.state(state, T, P, n);
 
             // Evaluate the aqueous chemical model
-			base_model(res, T, P, n);
-            
+            base_model(res, state);
+
             // Update the activity coefficients and activities of selected species
             for(auto pair : ln_activity_coeff_functions)
             {
@@ -86,6 +86,20 @@ struct AqueousPhase::Impl
                 const ChemicalScalar ln_mi = log(state.m[i]); // get the molality of the selected species
                 res.ln_activity_coefficients[i] = ln_gi; // update the ln activity coefficient selected species
                 res.ln_activities[i] = ln_gi + ln_mi; // update the ln activity of the selected species
+
+                // Update the low-rank molar derivatives of the ln activities, if provided by the base model, with a new column for the selected species
+                auto& lr = res.ln_activities_lowrank;
+                if(lr.D.size())
+                {
+                    const Index k = lr.U.cols();
+                    lr.U.conservativeResize(lr.U.rows(), k + 1);
+                    lr.V.conservativeResize(lr.V.rows(), k + 1);
+                    lr.U.row(i).setZero();
+                    lr.U.col(k).setZero();
+                    lr.U(i, k) = 1.0;
+                    lr.V.col(k) = tr(res.ln_activities.ddn.row(i));
+                    lr.V(i, k) -= lr.D[i];
+                }
             }
         };
 
@@ -40,6 +40,28 @@ struct GaseousPhase::Impl
     Impl(const GaseousMixture& mixture)
     : mixture(mixture)
     {}
+
+    /// Return the chemical model function of the phase that evaluates the state of the gaseous mixture before the given model
+    auto chemicalModel(const GaseousChemicalModel& base_model) const -> PhaseChemicalModel
+    {
+        // Create a copy of the data member `mixture` to be used in the following lambda function
+        auto mixture = this->mixture;
+
+        // The state of the gaseous mixture, whose memory is reused in every evaluation of the model below
+        GaseousMixtureState state;
+
+        // Define the function that calculates the chemical properties of the phase
+        PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+        {
+            // Evaluate the state of the gaseous mixture
+            mixture.state(state, T, P, n);
+
+            // Evaluate the gaseous chemical model
+            base_model(res, state);
+        };
+
+        return model;
+    }
 };
 
 GaseousPhase::GaseousPhase()
@@ -63,50 +85,43 @@ GaseousPhase::GaseousPhase(const GaseousMixture& mixture)
 
 auto GaseousPhase::setChemicalModelIdeal() -> GaseousPhase&
 {
-    PhaseChemicalModel model = gaseousChemicalModelIdeal(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(gaseousChemicalModelIdeal(mixture())));
     return *this;
 }
 
 auto GaseousPhase::setChemicalModelVanDerWaals() -> GaseousPhase&
 {
-    PhaseChemicalModel model = gaseousChemicalModelVanDerWaals(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(gaseousChemicalModelVanDerWaals(mixture())));
     return *this;
 }
 
 auto GaseousPhase::setChemicalModelRedlichKwong() -> GaseousPhase&
 {
-    PhaseChemicalModel model = gaseousChemicalModelRedlichKwong(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(gaseousChemicalModelRedlichKwong(mixture())));
     return *this;
 }
 
 auto GaseousPhase::setChemicalModelSoaveRedlichKwong() -> GaseousPhase&
 {
-    PhaseChemicalModel model = gaseousChemicalModelSoaveRedlichKwong(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(gaseousChemicalModelSoaveRedlichKwong(mixture())));
     return *this;
 }
 
 auto GaseousPhase::setChemicalModelPengRobinson() -> GaseousPhase&
 {
-    PhaseChemicalModel model = gaseousChemicalModelPengRobinson(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(gaseousChemicalModelPengRobinson(mixture())));
     return *this;
 }
 
 auto GaseousPhase::setChemicalModelSpycherPruessEnnis() -> GaseousPhase&
 {
-    PhaseChemicalModel model = gaseousChemicalModelSpycherPruessEnnis(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(gaseousChemicalModelSpycherPruessEnnis(mixture())));
     return *this;
 }
 
 auto GaseousPhase::setChemicalModelSpycherReed() -> GaseousPhase&
 {
-    PhaseChemicalModel model = gaseousChemicalModelSpycherReed(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(gaseousChemicalModelSpycherReed(mixture())));
     return *this;
 }
 
@@ -53,6 +53,28 @@ struct MineralPhase::Impl
     Impl(const MineralMixture& mixture)
     : mixture(mixture)
     {}
+
+    /// Return the chemical model function of the phase that evaluates the state of the mineral mixture before the given model
+    auto chemicalModel(const MineralChemicalModel& base_model) const -> PhaseChemicalModel
+    {
+        // Create a copy of the data member `mixture` to be used in the following lambda function
+        auto mixture = this->mixture;
+
+        // The state of the mineral mixture, whose memory is reused in every evaluation of the model below
+        MineralMixtureState state;
+
+        // Define the function that calculates the chemical properties of the phase
+        PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+        {
+            // Evaluate the state of the mineral mixture
+            mixture.state(state, T, P, n);
+
+            // Evaluate the mineral chemical model
+            base_model(res, state);
+        };
+
+        return model;
+    }
 };
 
 MineralPhase::MineralPhase()
@@ -80,15 +102,13 @@ MineralPhase::MineralPhase(const MineralSpecies& species)
 
 auto MineralPhase::setChemicalModelIdeal() -> MineralPhase&
 {
-    PhaseChemicalModel model = mineralChemicalModelIdeal(mixture());
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(mineralChemicalModelIdeal(mixture())));
     return *this;
 }
 
 auto MineralPhase::setChemicalModelRedlichKister(double a0, double a1, double a2) -> MineralPhase&
 {
-    PhaseChemicalModel model = mineralChemicalModelRedlichKister(mixture(), a0, a1, a2);
-    setChemicalModel(model);
+    setChemicalModel(pimpl->chemicalModel(mineralChemicalModelRedlichKister(mixture(), a0, a1, a2)));
     return *this;
 }
 
@@ -0,0 +1,291 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "WaterThermoStateTable.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoState.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoStateUtils.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The tabulated properties of water in a WaterThermoState instance
+ThermoScalar WaterThermoState::* const properties[] =
+{
+    &WaterThermoState::temperature,
+    &WaterThermoState::volume,
+    &WaterThermoState::entropy,
+    &WaterThermoState::helmholtz,
+    &WaterThermoState::internal_energy,
+    &WaterThermoState::enthalpy,
+    &WaterThermoState::gibbs,
+    &WaterThermoState::cv,
+    &WaterThermoState::cp,
+    &WaterThermoState::density,
+    &WaterThermoState::densityT,
+    &WaterThermoState::densityP,
+    &WaterThermoState::densityTT,
+    &WaterThermoState::densityTP,
+    &WaterThermoState::densityPP,
+    &WaterThermoState::pressure,
+    &WaterThermoState::pressureT,
+    &WaterThermoState::pressureD,
+    &WaterThermoState::pressureTT,
+    &WaterThermoState::pressureTD,
+    &WaterThermoState::pressureDD,
+};
+
+/// The number of tabulated properties of water
+const Index num_properties = sizeof(properties)/sizeof(properties[0]);
+
+/// The index of the density in the list of tabulated properties
+const Index idensity = 9;
+
+/// The number of tabulated values of a property at a grid point: its value and its T, P and TP derivatives
+const Index num_values = 4;
+
+auto isStrictlyIncreasing(const std::vector<double>& x) -> bool
+{
+    return std::adjacent_find(x.begin(), x.end(), std::greater_equal<double>()) == x.end();
+}
+
+/// Return the index of the grid interval that contains a coordinate inside the grid
+auto interval(const std::vector<double>& x, double val) -> Index
+{
+    const Index i = std::upper_bound(x.begin(), x.end(), val) - x.begin();
+    return std::min<Index>(i == 0 ? 0 : i - 1, x.size() - 2);
+}
+
+/// The cubic Hermite basis functions on the unit interval and their derivatives.
+/// The basis functions of the value at the left and right nodes are stored in `f`,
+/// and those of the slope at the left and right nodes in `g`, already scaled by the
+/// length `h` of the interval. The derivatives are with respect to the unscaled coordinate.
+struct HermiteBasis
+{
+    double f[2], g[2], df[2], dg[2];
+
+    HermiteBasis(double u, double h)
+    {
+        const double u2 = u*u;
+        const double u3 = u2*u;
+        f[0] = 2*u3 - 3*u2 + 1;
+        f[1] = -2*u3 + 3*u2;
+        g[0] = h*(u3 - 2*u2 + u);
+        g[1] = h*(u3 - u2);
+        df[0] = (6*u2 - 6*u)/h;
+        df[1] = (-6*u2 + 6*u)/h;
+        dg[0] = 3*u2 - 4*u + 1;
+        dg[1] = 3*u2 - 2*u;
+    }
+};
+
+} // namespace
+
+struct WaterThermoStateTable::Impl
+{
+    /// The temperature points of the grid (in units of K)
+    std::vector<double> temperatures;
+
+    /// The pressure points of the grid (in units of Pa)
+    std::vector<double> pressures;
+
+    /// The tabulated function that calculates the thermodynamic state of water
+    Function fn;
+
+    /// The values and the T, P and TP derivatives of every tabulated property at every grid point
+    std::vector<double> data;
+
+    Impl()
+    {}
+
+    Impl(const std::vector<double>& temperatures, const std::vector<double>& pressures, const Function& fn)
+    : temperatures(temperatures), pressures(pressures), fn(fn)
+    {
+        Assert(temperatures.size() > 1 && pressures.size() > 1,
+            "Could not create a WaterThermoStateTable instance.",
+            "At least two temperature points and two pressure points are required.");
+        Assert(isStrictlyIncreasing(temperatures) && isStrictlyIncreasing(pressures),
+            "Could not create a WaterThermoStateTable instance.",
+            "The temperature and pressure points must be in strictly increasing order.");
+
+        const Index nT = temperatures.size();
+        const Index nP = pressures.size();
+
+        data.resize(nT*nP*num_properties*num_values);
+
+        // Tabulate the values and the temperature and pressure derivatives of the properties
+        for(Index i = 0; i < nT; ++i)
+        {
+            for(Index j = 0; j < nP; ++j)
+            {
+                const WaterThermoState state = fn(temperatures[i], pressures[j]);
+                for(Index k = 0; k < num_properties; ++k)
+                {
+                    double* p = &data[offset(i, j, k)];
+                    p[0] = (state.*properties[k]).val;
+                    p[1] = (state.*properties[k]).ddT;
+                    p[2] = (state.*properties[k]).ddP;
+                }
+            }
+        }
+
+        // Tabulate the cross derivatives as the average of the finite differences of the first derivatives
+        for(Index i = 0; i < nT; ++i)
+        {
+            const Index ia = i > 0 ? i - 1 : i;
+            const Index ib = i < nT - 1 ? i + 1 : i;
+            for(Index j = 0; j < nP; ++j)
+            {
+                const Index ja = j > 0 ? j - 1 : j;
+                const Index jb = j < nP - 1 ? j + 1 : j;
+                for(Index k = 0; k < num_properties; ++k)
+                {
+                    const double ddTP = (data[offset(i, jb, k) + 1] - data[offset(i, ja, k) + 1])/(pressures[jb] - pressures[ja]);
+                    const double ddPT = (data[offset(ib, j, k) + 2] - data[offset(ia, j, k) + 2])/(temperatures[ib] - temperatures[ia]);
+                    data[offset(i, j, k) + 3] = 0.5*(ddTP + ddPT);
+                }
+            }
+        }
+    }
+
+    /// Return the position in the tabulated data of the k-th property at the (i, j) grid point
+    auto offset(Index i, Index j, Index k) const -> Index
+    {
+        return ((i*pressures.size() + j)*num_properties + k)*num_values;
+    }
+
+    auto contains(double T, double P) const -> bool
+    {
+        return !temperatures.empty() &&
+            T >= temperatures.front() && T <= temperatures.back() &&
+            P >= pressures.front() && P <= pressures.back();
+    }
+
+    /// Interpolate the k-th property within the grid cell whose lower corner is the (i, j) grid point
+    auto interpolate(Index i, Index j, const HermiteBasis& a, const HermiteBasis& b, Index k) const -> ThermoScalar
+    {
+        ThermoScalar res;
+        for(Index r = 0; r < 2; ++r)
+        {
+            for(Index s = 0; s < 2; ++s)
+            {
+                const double* p = &data[offset(i + r, j + s, k)];
+                res.val += p[0]*a.f[r]*b.f[s] + p[1]*a.g[r]*b.f[s] + p[2]*a.f[r]*b.g[s] + p[3]*a.g[r]*b.g[s];
+                res.ddT += p[0]*a.df[r]*b.f[s] + p[1]*a.dg[r]*b.f[s] + p[2]*a.df[r]*b.g[s] + p[3]*a.dg[r]*b.g[s];
+                res.ddP += p[0]*a.f[r]*b.df[s] + p[1]*a.g[r]*b.df[s] + p[2]*a.f[r]*b.dg[s] + p[3]*a.g[r]*b.dg[s];
+            }
+        }
+        return res;
+    }
+
+    /// Apply a function to the grid cell that contains the (T, P) point and the Hermite basis functions at this point
+    template<typename Fn>
+    auto cell(double T, double P, Fn fn) const -> decltype(fn(0, 0, HermiteBasis(0, 1), HermiteBasis(0, 1)))
+    {
+        const Index i = interval(temperatures, T);
+        const Index j = interval(pressures, P);
+        const double hT = temperatures[i + 1] - temperatures[i];
+        const double hP = pressures[j + 1] - pressures[j];
+        const HermiteBasis a((T - temperatures[i])/hT, hT);
+        const HermiteBasis b((P - pressures[j])/hP, hP);
+        return fn(i, j, a, b);
+    }
+
+    auto density(double T, double P) const -> ThermoScalar
+    {
+        if(!contains(T, P))
+            return evaluate(T, P).density;
+        return cell(T, P, [&](Index i, Index j, const HermiteBasis& a, const HermiteBasis& b)
+        {
+            return interpolate(i, j, a, b, idensity);
+        });
+    }
+
+    auto state(double T, double P) const -> WaterThermoState
+    {
+        if(!contains(T, P))
+            return evaluate(T, P);
+        return cell(T, P, [&](Index i, Index j, const HermiteBasis& a, const HermiteBasis& b)
+        {
+            WaterThermoState res;
+            for(Index k = 0; k < num_properties; ++k)
+                res.*properties[k] = interpolate(i, j, a, b, k);
+            return res;
+        });
+    }
+
+    /// Evaluate the tabulated function at a (T, P) point outside the grid
+    auto evaluate(double T, double P) const -> WaterThermoState
+    {
+        Assert(fn,
+            "Could not calculate the thermodynamic state of water with a WaterThermoStateTable instance.",
+            "The WaterThermoStateTable instance is empty.");
+        return fn(T, P);
+    }
+};
+
+WaterThermoStateTable::WaterThermoStateTable()
+: pimpl(new Impl())
+{}
+
+WaterThermoStateTable::WaterThermoStateTable(const std::vector<double>& temperatures, const std::vector<double>& pressures)
+: WaterThermoStateTable(temperatures, pressures, [](double T, double P)
+    { return waterThermoStateWagnerPruss(T, P, StateOfMatter::Liquid); })
+{}
+
+WaterThermoStateTable::WaterThermoStateTable(const std::vector<double>& temperatures, const std::vector<double>& pressures, const Function& fn)
+: pimpl(new Impl(temperatures, pressures, fn))
+{}
+
+auto WaterThermoStateTable::temperatures() const -> const std::vector<double>&
+{
+    return pimpl->temperatures;
+}
+
+auto WaterThermoStateTable::pressures() const -> const std::vector<double>&
+{
+    return pimpl->pressures;
+}
+
+auto WaterThermoStateTable::contains(double T, double P) const -> bool
+{
+    return pimpl->contains(T, P);
+}
+
+auto WaterThermoStateTable::empty() const -> bool
+{
+    return pimpl->temperatures.empty();
+}
+
+auto WaterThermoStateTable::density(double T, double P) const -> ThermoScalar
+{
+    return pimpl->density(T, P);
+}
+
+auto WaterThermoStateTable::operator()(double T, double P) const -> WaterThermoState
+{
+    return pimpl->state(T, P);
+}
+
+} // namespace Reaktoro
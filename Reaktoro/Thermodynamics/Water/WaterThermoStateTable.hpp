@@ -0,0 +1,103 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ThermoScalar.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+struct WaterThermoState;
+
+/// A type used to calculate the thermodynamic state of water from tabulated data.
+/// The thermodynamic state of water is evaluated once at every (T, P) point of a
+/// rectilinear grid, and then calculated at any other (T, P) point inside the grid
+/// using bicubic Hermite interpolation of the tabulated values and their temperature
+/// and pressure derivatives. The temperature and pressure derivatives of the
+/// interpolated properties are the analytic derivatives of the interpolating splines.
+/// At (T, P) points outside the grid, the tabulated function is evaluated instead.
+///
+/// By default, the Wagner and Pruss (1995) equation of state for liquid water is
+/// tabulated. With a grid spacing of 5 K and 25 bar over 0--300 °C and 1--500 bar,
+/// the errors of the interpolated density with respect to Wagner and Pruss (1995)
+/// in the liquid region (pressures above the saturation pressure) are:
+/// - below 1e-6 relative error for the density;
+/// - below 3e-4 kg/(m3*K) absolute error for its temperature derivative;
+/// - below 5e-4 relative error for its pressure derivative.
+/// The error bound grows at metastable liquid states below the saturation pressure,
+/// so the grid should not extend far into this region.
+///
+/// Copies of a WaterThermoStateTable instance share the same tabulated data,
+/// which is never changed after construction.
+/// @see WaterThermoState, waterThermoStateWagnerPruss
+class WaterThermoStateTable
+{
+public:
+    /// The signature of a function that calculates the thermodynamic state of water.
+    using Function = std::function<WaterThermoState(double, double)>;
+
+    /// Construct a default WaterThermoStateTable instance.
+    WaterThermoStateTable();
+
+    /// Construct a WaterThermoStateTable instance that tabulates the Wagner and Pruss (1995) equation of state for liquid water.
+    /// @param temperatures The temperature points of the grid in increasing order (in units of K)
+    /// @param pressures The pressure points of the grid in increasing order (in units of Pa)
+    WaterThermoStateTable(const std::vector<double>& temperatures, const std::vector<double>& pressures);
+
+    /// Construct a WaterThermoStateTable instance that tabulates a given function.
+    /// @param temperatures The temperature points of the grid in increasing order (in units of K)
+    /// @param pressures The pressure points of the grid in increasing order (in units of Pa)
+    /// @param fn The function that calculates the thermodynamic state of water
+    WaterThermoStateTable(const std::vector<double>& temperatures, const std::vector<double>& pressures, const Function& fn);
+
+    /// Return the temperature points of the grid (in units of K).
+    auto temperatures() const -> const std::vector<double>&;
+
+    /// Return the pressure points of the grid (in units of Pa).
+    auto pressures() const -> const std::vector<double>&;
+
+    /// Return true if the given (T, P) point is inside the grid.
+    auto contains(double T, double P) const -> bool;
+
+    /// Check if the WaterThermoStateTable instance is empty.
+    auto empty() const -> bool;
+
+    /// Calculate the density of water (in units of kg/m3).
+    /// @param T The temperature of water (in units of K)
+    /// @param P The pressure of water (in units of Pa)
+    auto density(double T, double P) const -> ThermoScalar;
+
+    /// Calculate the thermodynamic state of water.
+    /// @param T The temperature of water (in units of K)
+    /// @param P The pressure of water (in units of Pa)
+    auto operator()(double T, double P) const -> WaterThermoState;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<const Impl> pimpl;
+};
+
+} // namespace Reaktoro
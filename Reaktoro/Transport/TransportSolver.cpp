@@ -18,7 +18,9 @@
 #include "TransportSolver.hpp"
 
 // C++ includes
+#include <algorithm>
 #include <iomanip>
+#include <limits>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
@@ -37,6 +39,44 @@ auto row(TridiagonalMatrixType&& mat, Index index) -> ReturnType
         data.segment(length - 4, 2) : data.segment(3 * index, 3);
 }
 
+/// A line of cells along one direction of a structured mesh.
+struct StructuredMeshLine
+{
+    /// The index of the first cell in the line.
+    Index start;
+
+    /// The difference between the indices of consecutive cells in the line.
+    Index stride;
+
+    /// The number of cells in the line.
+    Index size;
+};
+
+/// Return the number of lines of cells along a direction of a structured mesh.
+inline auto numLines(const StructuredMesh& mesh, Index dim) -> Index
+{
+    const Index n[3] = { mesh.nx(), mesh.ny(), mesh.nz() };
+    return mesh.numCells() / n[dim];
+}
+
+/// Return a line of cells along a direction of a structured mesh.
+inline auto line(const StructuredMesh& mesh, Index dim, Index l) -> StructuredMeshLine
+{
+    const Index nx = mesh.nx(), ny = mesh.ny(), nz = mesh.nz();
+    switch(dim)
+    {
+        case 0: return { nx * l, 1, nx };
+        case 1: return { l % nx + nx * ny * (l / nx), nx, ny };
+        default: return { l, nx * ny, nz };
+    }
+}
+
+/// Return the harmonic mean of two diffusion coefficients.
+inline auto harmonic(double a, double b) -> double
+{
+    return (a + b > 0.0) ? 2.0 * a * b / (a + b) : 0.0;
+}
+
 } // namespace internal
 
 ChemicalField::ChemicalField(Index size, const ChemicalSystem& system)
@@ -91,6 +131,61 @@ auto ChemicalField::output(std::string filename, StringList quantities) -> void
 
 }
 
+ChemicalStateField::ChemicalStateField(Index size, const ChemicalSystem& system)
+: ChemicalStateField(size, ChemicalState(system))
+{}
+
+ChemicalStateField::ChemicalStateField(Index size, const ChemicalState& state)
+: m_size(size),
+  m_system(state.system()),
+  m_T(size),
+  m_P(size),
+  m_n(size, m_system.numSpecies()),
+  m_y(size, m_system.numElements()),
+  m_z(size, m_system.numSpecies())
+{
+    set(state);
+}
+
+auto ChemicalStateField::set(const ChemicalState& state) -> void
+{
+    for(Index i = 0; i < m_size; ++i)
+        set(i, state);
+}
+
+auto ChemicalStateField::set(Index index, const ChemicalState& state) -> void
+{
+    m_T[index] = state.temperature();
+    m_P[index] = state.pressure();
+    m_n.row(index) = state.speciesAmounts().transpose();
+    m_y.row(index) = state.elementDualPotentials().transpose();
+    m_z.row(index) = state.speciesDualPotentials().transpose();
+}
+
+auto ChemicalStateField::state(Index index) const -> ChemicalState
+{
+    ChemicalState res(m_system);
+    res.setTemperature(m_T[index]);
+    res.setPressure(m_P[index]);
+    res.setSpeciesAmounts(m_n.row(index).transpose());
+    res.setElementDualPotentials(m_y.row(index).transpose());
+    res.setSpeciesDualPotentials(m_z.row(index).transpose());
+    return res;
+}
+
+auto ChemicalStateField::view(Index index) -> ChemicalStateView
+{
+    return ChemicalStateView(m_T[index], m_P[index],
+        VectorMap(m_n.row(index).data(), m_n.cols()),
+        VectorMap(m_y.row(index).data(), m_y.cols()),
+        VectorMap(m_z.row(index).data(), m_z.cols()));
+}
+
+auto ChemicalStateField::elementAmounts() const -> MatrixRowMajor
+{
+    return m_n * m_system.formulaMatrix().transpose();
+}
+
 auto TridiagonalMatrix::resize(Index size) -> void
 {
     m_size = size;
@@ -159,6 +254,41 @@ auto TridiagonalMatrix::solve(VectorRef x) const -> void
     solve(x, x);
 }
 
+auto TridiagonalMatrix::solveMany(MatrixRowMajorRef X) const -> void
+{
+    const Index n = size();
+
+    auto curr = row(1).data(); // iterator to current row
+
+    //-------------------------------------------------------------------------
+    // Perform the forward solve with the L factor of the LU factorization
+    //-------------------------------------------------------------------------
+    for(Index i = 1; i < n; ++i, curr += 3)
+    {
+        const auto& a = curr[0]; // `a` value on the current row
+
+        X.row(i) -= a * X.row(i - 1);
+    }
+
+    curr -= 3; // step back so that curr points to the last row
+    const auto& bn = curr[1]; // `b` value on the last row
+    curr -= 3; // step back so that curr points to the second to last row
+
+    //-------------------------------------------------------------------------
+    // Perform the backward solve with the U factor of the LU factorization
+    //-------------------------------------------------------------------------
+    X.row(n - 1) /= bn;
+
+    for(Index i = 2; i <= n; ++i, curr -= 3)
+    {
+        const auto& k = n - i; // the index of the current row
+        const auto& b = curr[1]; // `b` value on the current row
+        const auto& c = curr[2]; // `c` value on the current row
+
+        X.row(k) = (X.row(k) - c * X.row(k + 1))/b;
+    }
+}
+
 TridiagonalMatrix::operator Matrix() const
 {
     const Index n = size();
@@ -191,6 +321,30 @@ auto Mesh::setDiscretization(Index num_cells, double xl, double xr) -> void
     m_xcells = linspace(num_cells, xl + 0.5*m_dx, xr - 0.5*m_dx);
 }
 
+StructuredMesh::StructuredMesh()
+{}
+
+StructuredMesh::StructuredMesh(Index nx, Index ny, Index nz, double lx, double ly, double lz)
+{
+    setDiscretization(nx, ny, nz, lx, ly, lz);
+}
+
+auto StructuredMesh::setDiscretization(Index nx, Index ny, Index nz, double lx, double ly, double lz) -> void
+{
+    Assert(nx > 0 && ny > 0 && nz > 0, "Could not set the discretization.",
+        "The number of cells along each direction needs to be positive.");
+
+    Assert(lx > 0.0 && ly > 0.0 && lz > 0.0, "Could not set the discretization.",
+        "The length of the domain along each direction needs to be positive.");
+
+    m_nx = nx;
+    m_ny = ny;
+    m_nz = nz;
+    m_dx = lx / nx;
+    m_dy = ly / ny;
+    m_dz = lz / nz;
+}
+
 TransportSolver::TransportSolver()
 {
 }
@@ -275,6 +429,69 @@ auto TransportSolver::initialize() -> void
 }
 
 auto TransportSolver::step(VectorRef u, VectorConstRef q) -> void
+{
+    // Compute the advection contributions to u
+    advect(u);
+
+    // Add the source contribution
+    u += dt * q;
+
+    A.solve(u);
+}
+
+auto TransportSolver::step(VectorRef u) -> void
+{
+    // Compute the advection contributions to u
+    advect(u);
+
+    A.solve(u);
+}
+
+auto TransportSolver::step(MatrixRowMajorRef U, VectorConstRef ubc) -> void
+{
+    const auto dx = mesh_.dx();
+    const auto num_cells = mesh_.numCells();
+    const auto alpha = velocity*dt/dx;
+    const auto icell0 = 0;
+    const auto icelln = num_cells - 1;
+
+    U0 = U;
+
+    Phi.resize(U.rows(), U.cols());
+
+    Phi.row(icell0).fill(2.0); //  this is very important to ensure correct flux limiting behavior for boundary cell.
+
+    // Calculate the flux limiters in the interior cells for all variables at once
+    for(Index icell = 1; icell < icelln; ++icell)
+    {
+        auto r = Phi.row(icell).array();
+
+        // Calculate the variation index `r = (uP - uW)/(uE - uP)` on current cell, with zero for uniform regions
+        r = (U0.row(icell) - U0.row(icell - 1)).array() / (U0.row(icell + 1) - U0.row(icell)).array();
+        r = (r == r).select(r, 0.0);
+
+        // Calculate the flux limiter phi based on the superbee limiter (https://en.wikipedia.org/wiki/Flux_limiter)
+        r = (2.0 * r).min(1.0).max(r.min(2.0)).max(0.0);
+    }
+
+    // Compute advection contributions to U for the interior cells
+    for(Index icell = 1; icell < icelln; ++icell)
+    {
+        const auto aux = 1.0 + 0.5 * (Phi.row(icell) - Phi.row(icell - 1)).array();
+        U.row(icell).array() += alpha * aux * (U0.row(icell - 1) - U0.row(icell)).array();
+    }
+
+    // Handle the left boundary cell
+    const auto aux = 1.0 + 0.5 * Phi.row(icell0).array();
+    U.row(icell0).array() += alpha * aux * (ubc.transpose() - U0.row(icell0)).array();
+
+    // Handle the right boundary cell
+    U.row(icelln) += alpha * (U0.row(icelln - 1) - U0.row(icelln));
+
+    A.solveMany(U);
+}
+
+auto TransportSolver::advect(VectorRef u) -> void
 {
     // TODO: Implement Kurganov-Tadmor method as detailed in their 2000 paper (not as in Wikipedia)
     const auto dx = mesh_.dx();
@@ -315,16 +532,167 @@ auto TransportSolver::step(VectorRef u, VectorConstRef q) -> void
 
     // Handle the right boundary cell
     u[icelln] += alpha * (u0[icelln - 1] - u0[icelln]);
+}
 
-    // Add the source contribution
-    u += dt * q;
+StructuredTransportSolver::StructuredTransportSolver()
+{}
 
-    A.solve(u);
+auto StructuredTransportSolver::setFaceVelocities(VectorConstRef vx_, VectorConstRef vy_, VectorConstRef vz_) -> void
+{
+    vx = vx_;
+    vy = vy_;
+    vz = vz_;
 }
 
-auto TransportSolver::step(VectorRef u) -> void
+auto StructuredTransportSolver::setDiffusionCoeff(double val) -> void
+{
+    diffusion_coeff = val;
+    diffusion.resize(0);
+}
+
+auto StructuredTransportSolver::setNumThreads(unsigned val) -> void
+{
+    num_threads = val;
+    pool.reset();
+}
+
+auto StructuredTransportSolver::initialize() -> void
+{
+    const Index num_cells = mesh_.numCells();
+
+    Assert(vx.size() == 0 || Index(vx.size()) == mesh_.numFacesX(), "Could not initialize the transport solver.",
+        "The number of velocities on the faces normal to the x-direction does not match the mesh.");
+    Assert(vy.size() == 0 || Index(vy.size()) == mesh_.numFacesY(), "Could not initialize the transport solver.",
+        "The number of velocities on the faces normal to the y-direction does not match the mesh.");
+    Assert(vz.size() == 0 || Index(vz.size()) == mesh_.numFacesZ(), "Could not initialize the transport solver.",
+        "The number of velocities on the faces normal to the z-direction does not match the mesh.");
+    Assert(diffusion.size() == 0 || Index(diffusion.size()) == num_cells, "Could not initialize the transport solver.",
+        "The number of diffusion coefficients does not match the number of cells in the mesh.");
+
+    // The diffusion coefficients in each cell, the same in all cells if not given per cell
+    const Vector D = diffusion.size() ? diffusion : constants(num_cells, diffusion_coeff);
+
+    const Index n[3] = { mesh_.nx(), mesh_.ny(), mesh_.nz() };
+    const double h[3] = { mesh_.dx(), mesh_.dy(), mesh_.dz() };
+
+    // Assemble and factorize the coefficient matrices of the implicit diffusion along each line of cells
+    for(Index dim = 0; dim < 3; ++dim)
+    {
+        lines[dim].clear();
+
+        if(n[dim] < 2)
+            continue;
+
+        const Index num_lines = internal::numLines(mesh_, dim);
+        const double factor = dt/(h[dim] * h[dim]);
+
+        lines[dim].resize(num_lines);
+
+        for(Index l = 0; l < num_lines; ++l)
+        {
+            const auto ln = internal::line(mesh_, dim, l);
+            auto& A = lines[dim][l];
+            A.resize(ln.size);
+
+            for(Index i = 0; i < ln.size; ++i)
+            {
+                const Index icell = ln.start + i * ln.stride;
+                const double betaW = (i > 0) ? factor * internal::harmonic(D[icell - ln.stride], D[icell]) : 0.0;
+                const double betaE = (i < ln.size - 1) ? factor * internal::harmonic(D[icell], D[icell + ln.stride]) : 0.0;
+                A.row(i) << -betaW, 1.0 + betaW + betaE, -betaE;
+            }
+
+            A.factorize();
+        }
+    }
+}
+
+auto StructuredTransportSolver::step(MatrixRowMajorRef U, VectorConstRef ubc) -> void
 {
-    step(u, zeros(u.size()));
+    const Index nx = mesh_.nx(), ny = mesh_.ny(), nz = mesh_.nz();
+    const Index n[3] = { nx, ny, nz };
+    const double h[3] = { mesh_.dx(), mesh_.dy(), mesh_.dz() };
+    const Vector* v[3] = { &vx, &vy, &vz };
+    const Index stride[3] = { 1, nx, nx * ny };
+    const Index fstride[3] = { 1, nx, nx * ny };
+
+    // Ensure the explicit upwind advection is stable along each direction
+    for(Index dim = 0; dim < 3; ++dim)
+        Assert(v[dim]->size() == 0 || v[dim]->cwiseAbs().maxCoeff() * dt <= h[dim],
+            "Could not step the transport solver.",
+            "The time step violates the CFL condition max|v|*dt/dx <= 1 along the " + std::string(1, "xyz"[dim]) + "-direction.");
+
+    // Create the threads once, to be reused in all steps, and the work memory of each thread
+    if(!pool)
+        pool = std::make_shared<ThreadPool>(num_threads);
+    work.resize(pool->numThreads());
+
+    U0 = U;
+
+    // Compute the advection contributions to U with upwind fluxes, in parallel over the cells
+    pool->parallelFor(mesh_.numCells(), [&](Index icell, Index)
+    {
+        const Index idx[3] = { icell % nx, (icell / nx) % ny, icell / (nx * ny) };
+        const Index fidx[3] = {
+            idx[0] + (nx + 1) * (idx[1] + ny * idx[2]),
+            idx[0] + nx * (idx[1] + (ny + 1) * idx[2]),
+            icell };
+
+        auto u = U.row(icell);
+
+        for(Index dim = 0; dim < 3; ++dim)
+        {
+            if(v[dim]->size() == 0)
+                continue;
+
+            const double coeff = dt/h[dim];
+            const double vW = (*v[dim])[fidx[dim]];
+            const double vE = (*v[dim])[fidx[dim] + fstride[dim]];
+
+            // The flux across the west face of the cell, coming from the boundary if inflow on the first cell
+            if(vW > 0.0)
+            {
+                if(idx[dim] > 0) u += coeff * vW * U0.row(icell - stride[dim]);
+                else u += coeff * vW * ubc.transpose();
+            }
+            else u += coeff * vW * U0.row(icell);
+
+            // The flux across the east face of the cell, coming from the boundary if inflow on the last cell
+            if(vE < 0.0)
+            {
+                if(idx[dim] < n[dim] - 1) u -= coeff * vE * U0.row(icell + stride[dim]);
+                else u -= coeff * vE * ubc.transpose();
+            }
+            else u -= coeff * vE * U0.row(icell);
+        }
+    }, 256);
+
+    // Solve the implicit diffusion along each direction, in parallel over the lines of cells
+    for(Index dim = 0; dim < 3; ++dim)
+    {
+        if(lines[dim].empty())
+            continue;
+
+        pool->parallelFor(lines[dim].size(), [&](Index l, Index thread)
+        {
+            const auto ln = internal::line(mesh_, dim, l);
+
+            // Solve in place if the cells in the line are contiguous
+            if(ln.stride == 1)
+                return lines[dim][l].solveMany(U.middleRows(ln.start, ln.size));
+
+            auto& W = work[thread];
+            W.resize(ln.size, U.cols());
+
+            for(Index i = 0; i < ln.size; ++i)
+                W.row(i) = U.row(ln.start + i * ln.stride);
+
+            lines[dim][l].solveMany(W);
+
+            for(Index i = 0; i < ln.size; ++i)
+                U.row(ln.start + i * ln.stride) = W.row(i);
+        }, std::max<Index>(256/n[dim], 1));
+    }
 }
 
 ReactiveTransportSolver::ReactiveTransportSolver(const ChemicalSystem& system)
@@ -336,6 +704,13 @@ ReactiveTransportSolver::ReactiveTransportSolver(const ChemicalSystem& system)
 auto ReactiveTransportSolver::setMesh(const Mesh& mesh) -> void
 {
     transportsolver.setMesh(mesh);
+    structured = false;
+}
+
+auto ReactiveTransportSolver::setMesh(const StructuredMesh& mesh) -> void
+{
+    structuredsolver.setMesh(mesh);
+    structured = true;
 }
 
 auto ReactiveTransportSolver::setVelocity(double val) -> void
@@ -343,9 +718,20 @@ auto ReactiveTransportSolver::setVelocity(double val) -> void
     transportsolver.setVelocity(val);
 }
 
+auto ReactiveTransportSolver::setFaceVelocities(VectorConstRef vx, VectorConstRef vy, VectorConstRef vz) -> void
+{
+    structuredsolver.setFaceVelocities(vx, vy, vz);
+}
+
 auto ReactiveTransportSolver::setDiffusionCoeff(double val) -> void
 {
     transportsolver.setDiffusionCoeff(val);
+    structuredsolver.setDiffusionCoeff(val);
+}
+
+auto ReactiveTransportSolver::setDiffusionCoeffs(VectorConstRef vals) -> void
+{
+    structuredsolver.setDiffusionCoeffs(vals);
 }
 
 auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> void
@@ -356,6 +742,7 @@ auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> vo
 auto ReactiveTransportSolver::setTimeStep(double val) -> void
 {
     transportsolver.setTimeStep(val);
+    structuredsolver.setTimeStep(val);
 }
 
 auto ReactiveTransportSolver::output() -> ChemicalOutput
@@ -366,41 +753,85 @@ auto ReactiveTransportSolver::output() -> ChemicalOutput
 
 auto ReactiveTransportSolver::initialize(const ChemicalField& field) -> void
 {
-    const Mesh& mesh = transportsolver.mesh();
+    initialize(field.size());
+}
+
+auto ReactiveTransportSolver::initialize(const ChemicalStateField& field) -> void
+{
+    initialize(field.size());
+}
+
+auto ReactiveTransportSolver::initialize(Index field_size) -> void
+{
     const Index num_elements = system_.numElements();
-    const Index num_cells = mesh.numCells();
+    const Index num_cells = structured ?
+        structuredsolver.mesh().numCells() : transportsolver.mesh().numCells();
+
+    Assert(field_size == num_cells, "Could not initialize the reactive transport solver.",
+        "The number of chemical states in the field does not match the number of cells in the mesh.");
 
     bf.resize(num_cells, num_elements);
     bs.resize(num_cells, num_elements);
     b.resize(num_cells, num_elements);
 
-    transportsolver.initialize();
+    // Ensure all cells are equilibrated in the first step
+    b0 = Matrix::Constant(num_cells, num_elements, std::numeric_limits<double>::quiet_NaN());
+    skipped.assign(num_cells, false);
+    skipped_fraction = 0.0;
+
+    // The formula matrices of the fluid and solid species used with fields of contiguous chemical states
+    Af = zeros(num_elements, system_.numSpecies());
+    As = zeros(num_elements, system_.numSpecies());
+    for(Index i : system_.indicesFluidSpecies())
+        Af.col(i) = system_.formulaMatrix().col(i);
+    for(Index i : system_.indicesSolidSpecies())
+        As.col(i) = system_.formulaMatrix().col(i);
+
+    if(structured) structuredsolver.initialize();
+    else transportsolver.initialize();
+}
+
+auto ReactiveTransportSolver::transport() -> void
+{
+    // Transport the elements in the fluid species all at once
+    if(structured) structuredsolver.step(bf, bbc);
+    else transportsolver.step(bf, bbc);
+
+    // Sum the amounts of elements distributed among fluid and solid species
+    b.noalias() = bf + bs;
+}
+
+auto ReactiveTransportSolver::skip(Index icell) -> bool
+{
+    const double reltol = options_.skip_reltol;
+    const double abstol = options_.skip_abstol;
+
+    // Skip the equilibrium calculation if the amounts of elements barely changed since the last one
+    skipped[icell] = (reltol >= 0.0 || abstol >= 0.0) &&
+        ((b.row(icell) - b0.row(icell)).array().abs() <=
+            std::max(abstol, 0.0) + std::max(reltol, 0.0) * b0.row(icell).array().abs()).all();
+
+    if(!skipped[icell])
+        b0.row(icell) = b.row(icell);
+
+    return skipped[icell];
 }
 
 auto ReactiveTransportSolver::step(ChemicalField& field) -> void
 {
-    const auto& mesh = transportsolver.mesh();
-    const auto& num_elements = system_.numElements();
-    const auto& num_cells = mesh.numCells();
+    const Index num_cells = b.rows();
     const auto& ifs = system_.indicesFluidSpecies();
     const auto& iss = system_.indicesSolidSpecies();
 
-    // Collect the amounts of elements in the solid and fluid species
+    // Collect the amounts of elements in the solid and fluid species, keeping those of skipped cells
     for(Index icell = 0; icell < num_cells; ++icell)
     {
+        if(skipped[icell]) continue;
         bf.row(icell) = field[icell].elementAmountsInSpecies(ifs);
         bs.row(icell) = field[icell].elementAmountsInSpecies(iss);
     }
 
-    // Transport the elements in the fluid species
-    for(Index ielement = 0; ielement < num_elements; ++ielement)
-    {
-        transportsolver.setBoundaryValue(bbc[ielement]);
-        transportsolver.step(bf.col(ielement));
-    }
-
-    // Sum the amounts of elements distributed among fluid and solid species
-    b.noalias() = bf + bs;
+    transport();
 
     for(auto output : outputs)
     {
@@ -408,11 +839,18 @@ auto ReactiveTransportSolver::step(ChemicalField& field) -> void
         output.open();
     }
 
+    Index num_skipped = 0;
+
     for(Index icell = 0; icell < num_cells; ++icell)
     {
-        const double T = field[icell].temperature();
-        const double P = field[icell].pressure();
-        equilibriumsolver.solve(field[icell], T, P, b.row(icell));
+        if(skip(icell))
+            ++num_skipped;
+        else
+        {
+            const double T = field[icell].temperature();
+            const double P = field[icell].pressure();
+            equilibriumsolver.solve(field[icell], T, P, b.row(icell));
+        }
 
         for(auto output : outputs)
             output.update(field[icell], icell);
@@ -421,6 +859,56 @@ auto ReactiveTransportSolver::step(ChemicalField& field) -> void
     for(auto output : outputs)
         output.close();
 
+    skipped_fraction = num_cells ? double(num_skipped)/num_cells : 0.0;
+
+    ++steps;
+}
+
+auto ReactiveTransportSolver::step(ChemicalStateField& field) -> void
+{
+    const Index num_cells = b.rows();
+    const auto n = field.speciesAmounts();
+    const auto T = field.temperatures();
+    const auto P = field.pressures();
+
+    // Collect the amounts of elements in the solid and fluid species directly from the contiguous species amounts
+    for(Index icell = 0; icell < num_cells; ++icell)
+    {
+        if(skipped[icell]) continue;
+        bf.row(icell).noalias() = n.row(icell) * Af.transpose();
+        bs.row(icell).noalias() = n.row(icell) * As.transpose();
+    }
+
+    transport();
+
+    for(auto output : outputs)
+    {
+        output.suffix("-" + std::to_string(steps));
+        output.open();
+    }
+
+    Index num_skipped = 0;
+
+    for(Index icell = 0; icell < num_cells; ++icell)
+    {
+        if(skip(icell))
+            ++num_skipped;
+        else
+            equilibriumsolver.solve(field.view(icell), T[icell], P[icell], b.row(icell));
+
+        if(!outputs.empty())
+        {
+            const ChemicalState state = field.state(icell);
+            for(auto output : outputs)
+                output.update(state, icell);
+        }
+    }
+
+    for(auto output : outputs)
+        output.close();
+
+    skipped_fraction = num_cells ? double(num_skipped)/num_cells : 0.0;
+
     ++steps;
 }
 
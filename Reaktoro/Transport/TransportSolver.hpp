@@ -24,9 +24,11 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/StringList.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Core/ChemicalOutput.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateView.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
@@ -111,6 +113,76 @@ private:
     std::vector<ChemicalProperties> m_properties;
 };
 
+/// A field of chemical states stored in contiguous arrays.
+/// The temperatures, pressures, molar amounts of the species, and dual potentials of the elements
+/// and species of all chemical states are stored in arrays with one row per state. The data of
+/// each state is accessible through a ChemicalStateView, which EquilibriumSolver accepts directly,
+/// and the data of all states can be read and written at once without gathering and scattering.
+class ChemicalStateField
+{
+public:
+    ChemicalStateField(Index size, const ChemicalSystem& system);
+
+    ChemicalStateField(Index size, const ChemicalState& state);
+
+    auto size() const -> Index { return m_size; }
+
+    auto system() const -> const ChemicalSystem& { return m_system; }
+
+    /// Set all chemical states in the field with a given one.
+    auto set(const ChemicalState& state) -> void;
+
+    /// Set a chemical state in the field.
+    auto set(Index index, const ChemicalState& state) -> void;
+
+    /// Return a copy of a chemical state in the field.
+    auto state(Index index) const -> ChemicalState;
+
+    /// Return a view of a chemical state in the field.
+    auto view(Index index) -> ChemicalStateView;
+
+    /// Return the temperatures of the chemical states (in units of K).
+    auto temperatures() -> VectorRef { return m_T; }
+
+    auto temperatures() const -> VectorConstRef { return m_T; }
+
+    /// Return the pressures of the chemical states (in units of Pa).
+    auto pressures() -> VectorRef { return m_P; }
+
+    auto pressures() const -> VectorConstRef { return m_P; }
+
+    /// Return the molar amounts of the species with one row per chemical state (in units of mol).
+    auto speciesAmounts() -> MatrixRowMajorRef { return m_n; }
+
+    auto speciesAmounts() const -> MatrixRowMajorConstRef { return m_n; }
+
+    /// Return the dual potentials of the elements with one row per chemical state (in units of J/mol).
+    auto elementDualPotentials() -> MatrixRowMajorRef { return m_y; }
+
+    auto elementDualPotentials() const -> MatrixRowMajorConstRef { return m_y; }
+
+    /// Return the dual potentials of the species with one row per chemical state (in units of J/mol).
+    auto speciesDualPotentials() -> MatrixRowMajorRef { return m_z; }
+
+    auto speciesDualPotentials() const -> MatrixRowMajorConstRef { return m_z; }
+
+    /// Return the molar amounts of the elements with one row per chemical state (in units of mol).
+    auto elementAmounts() const -> MatrixRowMajor;
+
+private:
+    /// The number of degrees of freedom in the chemical field.
+    Index m_size;
+
+    /// The chemical system common to all degrees of freedom in the chemical field.
+    ChemicalSystem m_system;
+
+    /// The temperatures and pressures of the chemical states.
+    Vector m_T, m_P;
+
+    /// The molar amounts of the species and the dual potentials of the elements and species of the chemical states.
+    MatrixRowMajor m_n, m_y, m_z;
+};
+
 class TridiagonalMatrix
 {
 public:
@@ -148,6 +220,10 @@ public:
 
     auto solve(VectorRef x) const -> void;
 
+    /// Solve the factorized system for many right-hand sides at once, stored in the columns of `X`.
+    /// This is not an overload of `solve`, which would make calls with a Vector argument ambiguous.
+    auto solveMany(MatrixRowMajorRef X) const -> void;
+
     operator Matrix() const;
 
 private:
@@ -194,7 +270,51 @@ private:
     Vector m_xcells;
 };
 
+/// A structured mesh of rectangular cells in two or three dimensions.
+/// The cells are ordered with `i` (the x-direction) varying fastest, then `j`, then `k`.
+class StructuredMesh
+{
+public:
+    StructuredMesh();
+
+    StructuredMesh(Index nx, Index ny, Index nz = 1, double lx = 1.0, double ly = 1.0, double lz = 1.0);
+
+    auto setDiscretization(Index nx, Index ny, Index nz = 1, double lx = 1.0, double ly = 1.0, double lz = 1.0) -> void;
+
+    auto numCells() const -> Index { return m_nx * m_ny * m_nz; }
+
+    auto nx() const -> Index { return m_nx; }
+
+    auto ny() const -> Index { return m_ny; }
+
+    auto nz() const -> Index { return m_nz; }
+
+    auto dx() const -> double { return m_dx; }
+
+    auto dy() const -> double { return m_dy; }
+
+    auto dz() const -> double { return m_dz; }
+
+    /// Return the index of the cell with given indices along the x, y and z directions.
+    auto index(Index i, Index j, Index k = 0) const -> Index { return i + m_nx * (j + m_ny * k); }
+
+    /// Return the number of faces normal to the x, y and z directions respectively.
+    auto numFacesX() const -> Index { return (m_nx + 1) * m_ny * m_nz; }
+
+    auto numFacesY() const -> Index { return m_nx * (m_ny + 1) * m_nz; }
+
+    auto numFacesZ() const -> Index { return m_nx * m_ny * (m_nz + 1); }
+
+private:
+    /// The number of cells along the x, y and z directions.
+    Index m_nx = 10, m_ny = 10, m_nz = 1;
+
+    /// The lengths of the cells along the x, y and z directions (in m).
+    double m_dx = 0.1, m_dy = 0.1, m_dz = 1.0;
+};
+
 /// Use this class for solving transport problems.
+/// Different TransportSolver instances can be used concurrently in different threads.
 class TransportSolver
 {
 public:
@@ -234,7 +354,15 @@ public:
     /// @param[in,out] u The solution vector
     auto step(VectorRef u) -> void;
 
+    /// Step the transport solver for many variables at once.
+    /// @param[in,out] U The solution matrix with one row per cell and one column per variable
+    /// @param ubc The values of the variables on the left boundary
+    auto step(MatrixRowMajorRef U, VectorConstRef ubc) -> void;
+
 private:
+    /// Add the advection contributions to the solution vector.
+    auto advect(VectorRef u) -> void;
+
     /// The mesh describing the discretization of the domain.
     Mesh mesh_;
 
@@ -258,9 +386,114 @@ private:
 
     /// The previous state of the variables.
     Vector u0;
+
+    /// The flux limiters at each cell for each variable in the multi-variable step.
+    MatrixRowMajor Phi;
+
+    /// The previous state of the variables in the multi-variable step.
+    MatrixRowMajor U0;
+};
+
+/// Use this class for solving transport problems on structured meshes in two or three dimensions.
+/// The advection is explicit, with first-order upwind fluxes computed from the velocities on the
+/// faces of the cells, and evaluated in parallel over the cells. The diffusion is implicit and
+/// solved with a locally one-dimensional (ADI-type) splitting, in which each line of cells
+/// along each direction is solved with a TridiagonalMatrix factorized once in @ref initialize.
+/// The boundaries are impermeable to diffusion, with inflow advective fluxes given by the
+/// boundary values of the variables. Different instances can be used concurrently in different
+/// threads. Copies of an instance made after its first step share its threads, in which case
+/// their parallel loops are executed one after the other.
+class StructuredTransportSolver
+{
+public:
+    /// Construct a default StructuredTransportSolver instance.
+    StructuredTransportSolver();
+
+    /// Set the mesh for the numerical solution of the transport problem.
+    auto setMesh(const StructuredMesh& mesh) -> void { mesh_ = mesh; }
+
+    /// Set the velocities on the faces of the cells for the transport problem.
+    /// @param vx The velocities on the faces normal to the x-direction (in m/s)
+    /// @param vy The velocities on the faces normal to the y-direction (in m/s)
+    /// @param vz The velocities on the faces normal to the z-direction (in m/s), empty if zero
+    auto setFaceVelocities(VectorConstRef vx, VectorConstRef vy, VectorConstRef vz = Vector()) -> void;
+
+    /// Set the same diffusion coefficient in all cells.
+    /// @param val The diffusion coefficient (in m^2/s)
+    auto setDiffusionCoeff(double val) -> void;
+
+    /// Set the diffusion coefficients in each cell.
+    /// @param vals The diffusion coefficients (in m^2/s)
+    auto setDiffusionCoeffs(VectorConstRef vals) -> void { diffusion = vals; }
+
+    /// Set the time step for the numerical solution of the transport problem.
+    auto setTimeStep(double val) -> void { dt = val; }
+
+    /// Set the number of threads used in the transport step (zero for the number of hardware threads).
+    auto setNumThreads(unsigned val) -> void;
+
+    /// Return the mesh.
+    auto mesh() const -> const StructuredMesh& { return mesh_; }
+
+    /// Initialize the transport solver before method @ref step is executed.
+    auto initialize() -> void;
+
+    /// Step the transport solver for many variables at once.
+    /// @param[in,out] U The solution matrix with one row per cell and one column per variable
+    /// @param ubc The values of the variables on the boundaries
+    auto step(MatrixRowMajorRef U, VectorConstRef ubc) -> void;
+
+private:
+    /// The mesh describing the discretization of the domain.
+    StructuredMesh mesh_;
+
+    /// The time step used to solve the transport problem (in s).
+    double dt = 0.0;
+
+    /// The velocities on the faces normal to the x, y and z directions (in m/s).
+    Vector vx, vy, vz;
+
+    /// The diffusion coefficients in each cell (in m^2/s), empty if the same in all cells.
+    Vector diffusion;
+
+    /// The diffusion coefficient in all cells if not given in each cell (in m^2/s).
+    double diffusion_coeff = 0.0;
+
+    /// The number of threads used in the transport step.
+    unsigned num_threads = 0;
+
+    /// The threads used in the transport step, created in the first step and shared by copies of this solver.
+    std::shared_ptr<ThreadPool> pool;
+
+    /// The factorized coefficient matrices of each line of cells along the x, y and z directions.
+    std::vector<TridiagonalMatrix> lines[3];
+
+    /// The previous state of the variables.
+    MatrixRowMajor U0;
+
+    /// The variables on a line of cells for each thread.
+    std::vector<MatrixRowMajor> work;
+};
+
+/// A struct that describes the options for a reactive transport calculation.
+struct ReactiveTransportOptions
+{
+    /// The relative tolerance for the variation of the amounts of elements in a cell below which its equilibrium calculation is skipped.
+    /// The equilibrium calculation in a cell is skipped if `|b - b0| <= skip_abstol + skip_reltol * |b0|` for all elements,
+    /// where `b0` are the amounts of elements at which the cell was last equilibrated. The changes in the amounts of
+    /// elements of skipped cells are carried over to the next steps, so that they accumulate until a new equilibrium
+    /// calculation is needed. For this reason, the chemical states of cells skipped in a step are not read at the
+    /// beginning of the next one, and changes made to them between steps are ignored unless the reactive transport
+    /// solver is initialized again. No cells are skipped if both tolerances are negative.
+    double skip_reltol = -1.0;
+
+    /// The absolute tolerance for the variation of the amounts of elements in a cell below which its equilibrium calculation is skipped (in mol).
+    double skip_abstol = -1.0;
 };
 
 /// Use this class for solving reactive transport problems.
+/// A ReactiveTransportSolver instance cannot be used concurrently in different threads. Instances
+/// constructed with different clones of a chemical system (see ChemicalSystem::clone) can.
 class ReactiveTransportSolver
 {
 public:
@@ -269,29 +502,67 @@ public:
 
     auto setMesh(const Mesh& mesh) -> void;
 
+    /// Set a structured mesh in two or three dimensions, which replaces the one-dimensional one.
+    auto setMesh(const StructuredMesh& mesh) -> void;
+
     auto setVelocity(double val) -> void;
 
+    /// Set the velocities on the faces of the cells of the structured mesh.
+    auto setFaceVelocities(VectorConstRef vx, VectorConstRef vy, VectorConstRef vz = Vector()) -> void;
+
     auto setDiffusionCoeff(double val) -> void;
 
+    /// Set the diffusion coefficients in each cell of the structured mesh.
+    auto setDiffusionCoeffs(VectorConstRef vals) -> void;
+
     auto setBoundaryState(const ChemicalState& state) -> void;
 
     auto setTimeStep(double val) -> void;
 
+    /// Set the options for the reactive transport calculation.
+    auto setOptions(const ReactiveTransportOptions& options) -> void { options_ = options; }
+
     auto system() const -> const ChemicalSystem& { return system_; }
 
+    /// Return the fraction of cells whose equilibrium calculation was skipped in the last step.
+    auto skippedFraction() const -> double { return skipped_fraction; }
+
     auto output() -> ChemicalOutput;
 
     auto initialize(const ChemicalField& field) -> void;
 
+    auto initialize(const ChemicalStateField& field) -> void;
+
     auto step(ChemicalField& field) -> void;
 
+    /// Step the reactive transport solver with chemical states stored in contiguous arrays.
+    auto step(ChemicalStateField& field) -> void;
+
 private:
+    /// Initialize the work memory of the reactive transport solver for a field with given number of chemical states.
+    auto initialize(Index field_size) -> void;
+
+    /// Transport the elements in the fluid species and sum the amounts of elements in each cell.
+    auto transport() -> void;
+
+    /// Return true if the equilibrium calculation of a cell can be skipped, updating its element amounts otherwise.
+    auto skip(Index icell) -> bool;
+
     /// The chemical system common to all degrees of freedom in the chemical field.
     ChemicalSystem system_;
 
+    /// The formula matrices of the fluid and solid species, with zero columns for the other species.
+    Matrix Af, As;
+
     /// The solver for solving the transport equations
     TransportSolver transportsolver;
 
+    /// The solver for solving the transport equations on a structured mesh
+    StructuredTransportSolver structuredsolver;
+
+    /// The boolean flag that indicates if the structured mesh is used
+    bool structured = false;
+
     /// The solver for solving the equilibrium equations
     EquilibriumSolver equilibriumsolver;
 
@@ -302,7 +573,7 @@ private:
     Vector bbc;
 
     /// The amounts of a fluid element on each cell of the mesh.
-    Matrix bf;
+    MatrixRowMajor bf;
 
     /// The amounts of a solid element on each cell of the mesh.
     Matrix bs;
@@ -312,6 +583,18 @@ private:
 
     /// The current number of steps in the solution of the reactive transport equations.
     Index steps = 0;
+
+    /// The options for the reactive transport calculation.
+    ReactiveTransportOptions options_;
+
+    /// The amounts of elements in each cell at the last equilibrium calculation of the cell (NaN if not yet equilibrated).
+    Matrix b0;
+
+    /// The flags that indicate the cells whose equilibrium calculation was skipped in the last step.
+    std::vector<bool> skipped;
+
+    /// The fraction of cells whose equilibrium calculation was skipped in the last step.
+    double skipped_fraction = 0.0;
 };
 
 } // namespace Reaktoro
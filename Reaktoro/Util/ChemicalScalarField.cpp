@@ -0,0 +1,181 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+//
+#include "ChemicalScalarField.hpp"
+
+// C++ includes
+#include <iomanip>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+
+struct ChemicalScalarField::Impl
+{
+    /// The partition of the chemical system.
+    Partition partition;
+
+    /// The number of points in the field.
+    Index npoints = 0;
+
+    /// The values of the scalar chemical field.
+    Vector val;
+
+    /// The derivatives of the scalar chemical field with respect to temperature.
+    Vector ddT;
+
+    /// The derivatives of the scalar chemical field with respect to pressure.
+    Vector ddP;
+
+    /// The derivatives of the scalar chemical field with respect to the amounts of each equilibrium element.
+    std::vector<Vector> ddbe;
+
+    /// The derivatives of the scalar chemical field with respect to the amounts of each kinetic species.
+    std::vector<Vector> ddnk;
+
+    /// Construct a default Impl instance.
+    Impl()
+    {}
+
+    /// Construct a Impl instance with given chemical system partition.
+    Impl(const Partition& partition, Index npoints)
+    : partition(partition), npoints(npoints),
+      val(zeros(npoints)), ddT(zeros(npoints)), ddP(zeros(npoints)),
+      ddbe(partition.numEquilibriumElements(), zeros(npoints)),
+      ddnk(partition.numKineticSpecies(), zeros(npoints))
+    {}
+};
+
+ChemicalScalarField::ChemicalScalarField()
+: pimpl(new Impl())
+{}
+
+ChemicalScalarField::ChemicalScalarField(const Partition& partition, Index npoints)
+: pimpl(new Impl(partition, npoints))
+{}
+
+ChemicalScalarField::ChemicalScalarField(const ChemicalScalarField& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+ChemicalScalarField::~ChemicalScalarField()
+{}
+
+auto ChemicalScalarField::operator=(ChemicalScalarField other) -> ChemicalScalarField&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ChemicalScalarField::partition() const -> const Partition&
+{
+    return pimpl->partition;
+}
+
+auto ChemicalScalarField::size() const -> Index
+{
+    return pimpl->npoints;
+}
+
+auto ChemicalScalarField::val() -> VectorRef
+{
+    return pimpl->val;
+}
+
+auto ChemicalScalarField::val() const -> VectorConstRef
+{
+    return pimpl->val;
+}
+
+auto ChemicalScalarField::ddT() -> VectorRef
+{
+    return pimpl->ddT;
+}
+
+auto ChemicalScalarField::ddT() const -> VectorConstRef
+{
+    return pimpl->ddT;
+}
+
+auto ChemicalScalarField::ddP() -> VectorRef
+{
+    return pimpl->ddP;
+}
+
+auto ChemicalScalarField::ddP() const -> VectorConstRef
+{
+    return pimpl->ddP;
+}
+
+auto ChemicalScalarField::ddbe() -> std::vector<Vector>&
+{
+    return pimpl->ddbe;
+}
+
+auto ChemicalScalarField::ddbe() const -> const std::vector<Vector>&
+{
+    return pimpl->ddbe;
+}
+
+auto ChemicalScalarField::ddnk() -> std::vector<Vector>&
+{
+    return pimpl->ddnk;
+}
+
+auto ChemicalScalarField::ddnk() const -> const std::vector<Vector>&
+{
+    return pimpl->ddnk;
+}
+
+auto operator<<(std::ostream& out, const ChemicalScalarField& f) -> std::ostream&
+{
+    const Partition& partition = f.partition();
+    const ChemicalSystem& system = partition.system();
+
+    const Indices& iee = partition.indicesEquilibriumElements();
+    const Indices& iks = partition.indicesKineticSpecies();
+
+    const Index Ee = partition.numEquilibriumElements();
+    const Index Nk = partition.numKineticSpecies();
+
+    out << std::left << std::setw(10) << "k";
+    out << std::left << std::setw(20) << "val";
+    out << std::left << std::setw(20) << "ddT";
+    out << std::left << std::setw(20) << "ddP";
+    for(Index i = 0; i < Ee; ++i)
+        out << std::left << std::setw(20) << "ddbe(" + system.element(iee[i]).name() + ")";
+    for(Index i = 0; i < Nk; ++i)
+        out << std::left << std::setw(20) << "ddnk(" + system.species(iks[i]).name() + ")";
+    out << std::endl;
+    for(Index k = 0; k < f.size(); ++k)
+    {
+        out << std::left << std::setw(10) << k;
+        out << std::left << std::setw(20) << f.val()[k];
+        out << std::left << std::setw(20) << f.ddT()[k];
+        out << std::left << std::setw(20) << f.ddP()[k];
+        for(Index i = 0; i < Ee; ++i)
+            out << std::left << std::setw(20) << f.ddbe()[i][k];
+        for(Index i = 0; i < Nk; ++i)
+            out << std::left << std::setw(20) << f.ddnk()[i][k];
+        out << std::endl;
+    }
+
+    return out;
+}
+
+} // namespace Reaktoro
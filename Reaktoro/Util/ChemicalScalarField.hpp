@@ -0,0 +1,151 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+//
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <ostream>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// A type that contains the values of a scalar field and its derivatives.
+/// The derivatives of the field at every point are with respect to temperature, pressure,
+/// molar amounts of the equilibrium elements, and molar amounts of the kinetic species.
+/// Each derivative is stored in its own contiguous array over the field points.
+class ChemicalScalarField
+{
+public:
+    /// Construct a default ChemicalScalarField instance.
+    ChemicalScalarField();
+
+    /// Construct a ChemicalScalarField instance with given chemical system partition.
+    /// @param partition The partition of the chemical system.
+    /// @param npoints The number of points in the field.
+    ChemicalScalarField(const Partition& partition, Index npoints);
+
+    /// Construct a copy of a ChemicalScalarField instance.
+    ChemicalScalarField(const ChemicalScalarField& other);
+
+    /// Destroy this instance.
+    virtual ~ChemicalScalarField();
+
+    /// Construct a copy of a ChemicalScalarField instance.
+    auto operator=(ChemicalScalarField other) -> ChemicalScalarField&;
+
+    /// Set the field at the i-th point with a chemical scalar.
+    /// The derivatives of the scalar with respect to the amounts of the equilibrium species are
+    /// converted into derivatives with respect to temperature, pressure, and amounts of the
+    /// equilibrium elements using the chemical rule with the equilibrium sensitivity. This method
+    /// does not allocate memory and can be called concurrently for different field points.
+    /// @param i The index of the field point.
+    /// @param scalar The chemical scalar to be set at the i-th point.
+    /// @param sensitivity The equilibrium sensitivity at the i-th point.
+    template<typename V, typename N>
+    auto set(Index i, const ChemicalScalarBase<V, N>& scalar, const EquilibriumSensitivity& sensitivity) -> void;
+
+    /// Return the partition of the chemical system.
+    auto partition() const -> const Partition&;
+
+    /// Return the size of the chemical field.
+    auto size() const -> Index;
+
+    /// Return a reference to the values of the chemical field.
+    auto val() -> VectorRef;
+
+    /// Return a const reference to the values of the chemical field.
+    auto val() const -> VectorConstRef;
+
+    /// Return a reference to the derivatives w.r.t. temperature of the chemical field.
+    auto ddT() -> VectorRef;
+
+    /// Return a const-reference to the derivatives w.r.t. temperature of the chemical field.
+    auto ddT() const -> VectorConstRef;
+
+    /// Return a reference to the derivatives w.r.t. pressure of the chemical field.
+    auto ddP() -> VectorRef;
+
+    /// Return a const-reference to the derivatives w.r.t. pressure of the chemical field.
+    auto ddP() const -> VectorConstRef;
+
+    /// Return a reference to the derivatives w.r.t. molar amounts of equilibrium elements of the chemical field.
+    auto ddbe() -> std::vector<Vector>&;
+
+    /// Return a const-reference to the derivatives w.r.t. molar amounts of equilibrium elements of the chemical field.
+    auto ddbe() const -> const std::vector<Vector>&;
+
+    /// Return a reference to the derivatives w.r.t. molar amounts of kinetic species of the chemical field.
+    auto ddnk() -> std::vector<Vector>&;
+
+    /// Return a const-reference to the derivatives w.r.t. molar amounts of kinetic species of the chemical field.
+    auto ddnk() const -> const std::vector<Vector>&;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+/// Output a ChemicalScalarField instance.
+auto operator<<(std::ostream& out, const ChemicalScalarField& f) -> std::ostream&;
+
+template<typename V, typename N>
+auto ChemicalScalarField::set(Index i, const ChemicalScalarBase<V, N>& scalar, const EquilibriumSensitivity& sensitivity) -> void
+{
+    // The indices of the equilibrium and kinetic species
+    const Indices& ies = partition().indicesEquilibriumSpecies();
+    const Indices& iks = partition().indicesKineticSpecies();
+
+    // The derivatives of the field w.r.t. amounts of equilibrium elements and kinetic species
+    std::vector<Vector>& fbe = ddbe();
+    std::vector<Vector>& fnk = ddnk();
+
+    // The derivatives of the scalar w.r.t. temperature and pressure, at constant amounts of elements
+    double scalar_T = scalar.ddT;
+    double scalar_P = scalar.ddP;
+    for(Index k = 0; k < ies.size(); ++k)
+    {
+        scalar_T += scalar.ddn[ies[k]] * sensitivity.dndT[k];
+        scalar_P += scalar.ddn[ies[k]] * sensitivity.dndP[k];
+    }
+
+    val()[i] = scalar.val;
+    ddT()[i] = scalar_T;
+    ddP()[i] = scalar_P;
+
+    // Set derivative w.r.t. amounts of equilibrium elements at the i-th position
+    for(Index j = 0; j < fbe.size(); ++j)
+    {
+        double scalar_be = 0.0;
+        for(Index k = 0; k < ies.size(); ++k)
+            scalar_be += scalar.ddn[ies[k]] * sensitivity.dndb(k, j);
+        fbe[j][i] = scalar_be;
+    }
+
+    // Set derivative w.r.t. amounts of kinetic species at the i-th position
+    for(Index j = 0; j < fnk.size(); ++j)
+        fnk[j][i] = scalar.ddn[iks[j]];
+}
+
+} // namespace Reaktoro
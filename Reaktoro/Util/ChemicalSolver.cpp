@@ -15,629 +15,666 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 //
-//#include "ChemicalSolver.hpp"
-//
-//// C++ includes
-//#include <vector>
-//
-//// Reaktoro includes
-//#include <Reaktoro/Common/Exception.hpp>
-//#include <Reaktoro/Core/ChemicalProperties.hpp>
-//#include <Reaktoro/Core/ChemicalState.hpp>
-//#include <Reaktoro/Core/ChemicalSystem.hpp>
-//#include <Reaktoro/Core/Partition.hpp>
-//#include <Reaktoro/Core/ReactionSystem.hpp>
-//#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
-//#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
-//#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
-//#include <Reaktoro/Kinetics/KineticSolver.hpp>
-//#include <Reaktoro/Util/ChemicalField.hpp>
-//
-//namespace Reaktoro {
-//
-//struct ChemicalSolver::Impl
-//{
-//    /// The chemical system instance
-//    ChemicalSystem system;
-//
-//    /// The reaction system instance
-//    ReactionSystem reactions;
-//
-//    /// The number of field points
-//    Index npoints;
-//
-//    /// The partitioning of the chemical system
-//    Partition partition;
-//
-//    /// The number of species and elements in the system
-//    Index N, E;
-//
-//    /// The number of species and elements in the equilibrium partition
-//    Index Ne, Ee, Nk, Nfp;
-//
-//    /// The number of components
-//    Index Nc;
-//
-//    /// The chemical states at each point in the field
-//    std::vector<ChemicalState> states;
-//
-//    /// The chemical properties at each point in the field
-//    std::vector<ChemicalProperties> properties;
-//
-//    /// The equilibrium solver
-//    EquilibriumSolver equilibriumsolver;
-//
-//    /// The kinetic solver
-//    KineticSolver kineticsolver;
-//
-//    /// The equilibrium sensitivity at every field point
-//    std::vector<EquilibriumSensitivity> sensitivities;
-//
-//    /// The molar amounts of the chemical components at every field point
-//    std::vector<Vector> c;
-//
-//    /// The kinetic rates of the chemical components and their derivatives at every field point (in units of mol/s)
-//    std::vector<ChemicalField> rc;
-//
-//    /// The molar amounts of equilibrium species and their derivatives at every field point
-//    std::vector<ChemicalField> ne;
-//
-//    /// The porosity at every field point and their derivatives
-//    ChemicalField porosity;
-//
-//    /// The saturations of the fluid phases and their derivatives at every field point
-//    std::vector<ChemicalField> fluid_saturations;
-//
-//    /// The densities of the fluid phases and their derivatives at every field point (in units of kg/m3)
-//    std::vector<ChemicalField> fluid_densities;
-//
-//    /// The volumes of the fluid phases and their derivatives at every field point (in units of m3)
-//    std::vector<ChemicalField> fluid_volumes;
-//
-//    /// The total volume of the fluid phases and their derivatives at every field point (in units of m3)
-//    ChemicalField fluid_total_volume;
-//
-//    /// The total volume of the solid phases and their derivatives at every field point (in units of m3)
-//    ChemicalField solid_total_volume;
-//
-//    /// Construct a default Impl instance
-//    Impl()
-//    {}
-//
-//    /// Construct a custom Impl instance with given chemical system
-//    Impl(const ChemicalSystem& system, Index npoints)
-//    : system(system),
-//      npoints(npoints),
-//      states(npoints, ChemicalState(system)),
-//      properties(npoints),
-//      equilibriumsolver(system)
-//    {
-//        setPartition(Partition(system));
-//    }
-//
-//    /// Construct a custom Impl instance with given reaction system
-//    Impl(const ReactionSystem& reactions, Index npoints)
-//    : system(reactions.system()),
-//      reactions(reactions),
-//      npoints(npoints),
-//      states(npoints, ChemicalState(system)),
-//      properties(npoints),
-//      equilibriumsolver(system),
-//      kineticsolver(reactions)
-//    {
-//        // Initialize the number of species and elements in the system
-//        N = system.numSpecies();
-//        E = system.numElements();
-//
-//        // Initialize the default partition of the chemical system
-//        setPartition(Partition(system));
-//    }
-//
-//    /// Set the partition of the chemical system
-//    auto setPartition(const Partition& partition_) -> void
-//    {
-//        // Set the partition of the chemical solver
-//        partition = partition_;
-//
-//        // Initialize the number-type variables
-//        Ne  = partition.numEquilibriumSpecies();
-//        Nk  = partition.numKineticSpecies();
-//        Nfp = partition.numFluidPhases();
-//        Ee  = partition.numEquilibriumElements();
-//        Nc  = Ee + Nk;
-//
-//        // Set the partition of the equilibrium and kinetic solvers
-//        if(Ne) equilibriumsolver.setPartition(partition);
-//        if(Nk) kineticsolver.setPartition(partition);
-//
-//        // Initialize the sensitivities member
-//        sensitivities.resize(npoints);
-//    }
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Array<double> b) -> void
-//    {
-//        Assert(T.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of temperature values as there are field points.");
-//
-//        Assert(P.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of pressure values as there are field points.");
-//
-//        Assert(b.size == npoints * Ee,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting, for each equilibrium element, the same number of amount "
-//            "values as there are field points.");
-//
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            const auto Tk = T.data[k];
-//            const auto Pk = P.data[k];
-//            const auto bk = b.data + k*Ee;
-//            equilibriumsolver.solve(states[k], Tk, Pk, bk);
-//            properties[k] = states[k].properties();
-//            sensitivities[k] = equilibriumsolver.sensitivity();
-//        }
-//    }
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Grid<double> b) -> void
-//    {
-//        Assert(T.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of temperature values as there are field points.");
-//
-//        Assert(P.size == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting the same number of pressure values as there are field points.");
-//
-//        Assert(b.rows == Ee && b.cols == npoints,
-//            "Could not perform equilibrium calculations.",
-//            "Expecting, for each equilibrium element, the same number of amount "
-//            "values as there are field points.");
-//
-//        Vector bk(Ee);
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            const auto Tk  = T.data[k];
-//            const auto Pk  = P.data[k];
-//            for(Index j = 0; j < Ee; ++j)
-//                bk[j] = b.data[j][k];
-//            equilibriumsolver.solve(states[k], Tk, Pk, bk);
-//            properties[k] = states[k].properties();
-//            sensitivities[k] = equilibriumsolver.sensitivity();
-//        }
-//    }
-//
-//    /// React the chemical state at every field point.
-//    auto react(double t, double dt) -> void
-//    {
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            kineticsolver.solve(states[k], t, dt);
-//            properties[k] = states[k].properties();
-//        }
-//    }
-//
-//    /// Update the molar amounts of the chemical components at every field point.
-//    auto updateComponentAmounts() -> void
-//    {
-//        // Check if member `c` is initialized
-//        if(c.size() != Nc)
-//            c.resize(Nc, Vector(npoints));
-//
-//        // The indices of the equilibrium elements and kinetic species
-//        const Indices& ies = partition.indicesEquilibriumSpecies();
-//        const Indices& iee = partition.indicesEquilibriumElements();
-//        const Indices& iks = partition.indicesKineticSpecies();
-//
-//        // The molar amounts of elements in the equilibrium species
-//        Vector bes(E);
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the molar amounts of all species
-//            VectorConstRef n = states[k].speciesAmounts();
-//
-//            // Calculate the molar amounts of the elements in the equilibrium species
-//            bes = states[k].elementAmountsInSpecies(ies);
-//
-//            // Loop over all equilibrium elements
-//            for(Index j = 0; j < Ee; ++j)
-//                c[j][k] = bes[iee[j]];
-//
-//            // Loop over all kinetic species
-//            for(Index i = 0; i < Nk; ++i)
-//                c[i + Ee][k] = n[iks[i]];
-//        }
-//    }
-//
-//    /// Update the molar amounts of the equilibrium species and their derivatives at every field point.
-//    auto updateEquilibriumSpeciesAmounts() -> void
-//    {
-//        // Check if member `ne` is initialized
-//        if(ne.size() != Ne)
-//            ne.resize(Ne, ChemicalField(partition, npoints));
-//
-//        // The indices of the equilibrium species
-//        const Indices& ies = partition.indicesEquilibriumSpecies();
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Loop over all equilibrium species
-//            for(Index i = 0; i < Ne; ++i)
-//            {
-//                // Set the molar amount of the current equilibrium species
-//                ne[i].val()[k] = states[k].speciesAmount(ies[i]);
-//
-//                // Set the sensitivity of the current equilibrium species w.r.t. temperature
-//                ne[i].ddT()[k] = sensitivities[k].dnedT[i];
-//
-//                // Set the sensitivity of the current equilibrium species w.r.t. pressure
-//                ne[i].ddP()[k] = sensitivities[k].dnedP[i];
-//
-//                // Set the sensitivity of the current equilibrium species w.r.t. molar amount of each equilibrium element
-//                for(Index j = 0; j < Ee; ++j)
-//                    ne[i].ddbe()[j][k] = sensitivities[k].dnedbe(i, j);
-//            }
-//        }
-//    }
-//
-//    /// Update the porosity and their derivatives at every field point.
-//    auto updatePorosity() -> void
-//    {
-//        // Check if member `porosity` is initialized
-//        if(!porosity.size())
-//            porosity = ChemicalField(partition, npoints);
-//
-//        // The porosity
-//        ChemicalScalar phi;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Calculate porosity at current field point
-//            phi = 1.0 - properties[k].solidVolume();
-//            porosity.set(k, phi, sensitivities[k]);
-//        }
-//    }
-//
-//    /// Get the saturation of each fluid phase at every field point.
-//    auto updateFluidSaturations() -> void
-//    {
-//        // Check if member `fluid_saturations` is initialized
-//        if(fluid_saturations.size() != Nfp)
-//            fluid_saturations.resize(Nfp, ChemicalField(partition, npoints));
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The volumes of the fluid phases and their saturations
-//        ChemicalVector fluid_volumes, fluid_saturation;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the volumes of the fluid phases
-//            fluid_volumes = rows(properties[k].phaseVolumes(), ifp);
-//
-//            // Compute the saturation of all fluid phases
-//            fluid_saturation = fluid_volumes/sum(fluid_volumes);
-//
-//            // Loop over all fluid phases
-//            for(Index j = 0; j < Nfp; ++j)
-//                fluid_saturations[j].set(k, fluid_saturation[j], sensitivities[k]);
-//        }
-//    }
-//
-//    /// Get the density of each fluid phase at every field point.
-//    auto updateFluidDensities() -> void
-//    {
-//        // Check if member `fluid_densities` is initialized
-//        if(fluid_densities.size() != Nfp)
-//            fluid_densities.resize(Nfp, ChemicalField(partition, npoints));
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The densities of all phases at a field point
-//        ChemicalVector rho;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the densities of all phases
-//            rho = rows(properties[k].phaseDensities(), ifp);
-//
-//            // Loop over all fluid phases
-//            for(Index j = 0; j < Nfp; ++j)
-//                fluid_densities[j].set(k, rho[j], sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the volumes of each fluid phase at every field point.
-//    auto updateFluidVolumes() -> void
-//    {
-//        // Check if member `fluid_volumes` is initialized
-//        if(fluid_volumes.size() != Nfp)
-//            fluid_volumes.resize(Nfp, ChemicalField(partition, npoints));
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The volumes of all fluid phases
-//        ChemicalVector volumes;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Get the volumes of all phases
-//            volumes = rows(properties[k].phaseVolumes(), ifp);
-//
-//            // Loop over all fluid phases
-//            for(Index j = 0; j < Nfp; ++j)
-//                fluid_volumes[j].set(k, volumes[j], sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the total volume of the fluid phases at every field point.
-//    auto updateFluidTotalVolume() -> void
-//    {
-//        // Check if member `fluid_total_volume` is initialized
-//        if(!fluid_total_volume.size())
-//            fluid_total_volume = ChemicalField(partition, npoints);
-//
-//        // The indices of the fluid phases
-//        const Indices& ifp = partition.indicesFluidPhases();
-//
-//        // The total fluid volume at a field point
-//        ChemicalScalar total_volume;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Calculate the total fluid volume at current field point
-//            total_volume = sum(rows(properties[k].phaseVolumes(), ifp));
-//            fluid_total_volume.set(k, total_volume, sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the total volume of the solid phases at every field point.
-//    auto updateSolidTotalVolume() -> void
-//    {
-//        // Check if member `solid_total_volume` is initialized
-//        if(!solid_total_volume.size())
-//            solid_total_volume = ChemicalField(partition, npoints);
-//
-//        // The indices of the solid phases
-//        const Indices& isp = partition.indicesSolidPhases();
-//
-//        // The total solid volume at a field point
-//        ChemicalScalar total_volume;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            // Calculate the total solid volume at current field point
-//            total_volume = sum(rows(properties[k].phaseVolumes(), isp));
-//            solid_total_volume.set(k, total_volume, sensitivities[k]);
-//        }
-//    }
-//
-//    /// Update the kinetic rates of the chemical components at every field point.
-//    auto updateComponentRates() -> void
-//    {
-//        // Check if member `rc` is initialized
-//        if(rc.size() != Nc)
-//            rc.resize(Nc, ChemicalField(partition, npoints));
-//
-//        // Skip the calculation if there are no reactions
-//        if(reactions.numReactions() == 0)
-//            return;
-//
-//        // The indices of the elements and species in the equilibrium partition
-//        const Indices& iee = partition.indicesEquilibriumElements();
-//        const Indices& ies = partition.indicesEquilibriumSpecies();
-//
-//        // The indices of the species in the kinetic partition
-//        const Indices& iks = partition.indicesKineticSpecies();
-//
-//        // The formula matrix w.r.t. the species and elements in the equilibrium partition
-//        const Matrix We = submatrix(system.formulaMatrix(), iee, ies);
-//
-//        // The stoichiometric matrices w.r.t. the equilibrium and kinetic species
-//        const Matrix Se = cols(reactions.stoichiometricMatrix(), ies);
-//        const Matrix Sk = cols(reactions.stoichiometricMatrix(), iks);
-//
-//        // Initialise the coefficient matrix `A` of the chemical kinetics problem
-//        Matrix A(Ee + Nk, reactions.numReactions());
-//        A.topRows(Ee) = We * tr(Se);
-//        A.bottomRows(Nk) = tr(Sk);
-//
-//        ChemicalVector rates, r;
-//
-//        // Loop over all field points
-//        for(Index k = 0; k < npoints; ++k)
-//        {
-//            r = reactions.rates(properties[k]);
-//
-//            rates.val = A * r.val;
-//            rates.ddT = A * r.ddT;
-//            rates.ddP = A * r.ddP;
-//            rates.ddn = A * r.ddn;
-//
-//            // Loop over all equilibrium elements
-//            for(Index j = 0; j < Ee; ++j)
-//                rc[j].set(k, rates[j], sensitivities[k]);
-//
-//            // Loop over all kinetic species
-//            for(Index i = 0; i < Nk; ++i)
-//                rc[i + Ee].set(k, rates[i + Ee], sensitivities[k]);
-//        }
-//    }
-//};
-//
-//ChemicalSolver::ChemicalSolver()
-//: pimpl(new Impl())
-//{}
-//
-//ChemicalSolver::ChemicalSolver(const ChemicalSystem& system, Index npoints)
-//: pimpl(new Impl(system, npoints))
-//{}
-//
-//ChemicalSolver::ChemicalSolver(const ReactionSystem& reactions, Index npoints)
-//: pimpl(new Impl(reactions, npoints))
-//{}
-//
-//auto ChemicalSolver::numPoints() const -> Index
-//{
-//    return pimpl->npoints;
-//}
-//
-//auto ChemicalSolver::numEquilibriumElements() const -> Index
-//{
-//    return pimpl->Ee;
-//}
-//
-//auto ChemicalSolver::numKineticSpecies() const -> Index
-//{
-//    return pimpl->Nk;
-//}
-//
-//auto ChemicalSolver::numComponents() const -> Index
-//{
-//    return pimpl->Nc;
-//}
-//
-//auto ChemicalSolver::setPartition(const Partition& partition) -> void
-//{
-//    pimpl->setPartition(partition);
-//}
-//
-//auto ChemicalSolver::setStates(const ChemicalState& state) -> void
-//{
-//    for(Index k = 0; k < pimpl->npoints; ++k)
-//        pimpl->states[k] = state;
-//}
-//
-//auto ChemicalSolver::setStates(const Array<ChemicalState>& states) -> void
-//{
-//    Assert(states.size == pimpl->npoints,
-//        "Could not set the chemical states at every field point.",
-//        "Expecting the same number of chemical states as there are field points.");
-//    for(Index k = 0; k < states.size; ++k)
-//        pimpl->states[k] = states.data[k];
-//}
-//
-//auto ChemicalSolver::setStateAt(Index ipoint, const ChemicalState& state) -> void
-//{
-//    Assert(ipoint < pimpl->npoints,
-//        "Could not set the chemical state at given field point.",
-//        "Expecting a field point index smaller than the number of field points.");
-//    pimpl->states[ipoint] = state;
-//}
-//
-//auto ChemicalSolver::setStateAt(const Array<Index>& ipoints, const ChemicalState& state) -> void
-//{
-//    Assert(ipoints.size < pimpl->npoints,
-//        "Could not set the chemical state at given field points.",
-//        "Expecting field point indices smaller than the number of field points.");
-//    for(Index k = 0; k < ipoints.size; ++k)
-//        setStateAt(ipoints.data[k], state);
-//}
-//
-//auto ChemicalSolver::setStateAt(const Array<Index>& ipoints, const Array<ChemicalState>& states) -> void
-//{
-//    Assert(ipoints.size < pimpl->npoints,
-//        "Could not set the chemical state at given field points.",
-//        "Expecting field point indices smaller than the number of field points.");
-//    Assert(ipoints.size == states.size,
-//        "Could not set the chemical state at given field points.",
-//        "Expecting the same number of field point indices and chemical states.");
-//    for(Index k = 0; k < ipoints.size; ++k)
-//        setStateAt(ipoints.data[k], states.data[k]);
-//}
-//
-//auto ChemicalSolver::equilibrate(Array<double> T, Array<double> P, Array<double> be) -> void
-//{
-//    pimpl->equilibrate(T, P, be);
-//}
-//
-//auto ChemicalSolver::equilibrate(Array<double> T, Array<double> P, Grid<double> be) -> void
-//{
-//    pimpl->equilibrate(T, P, be);
-//}
-//
-//auto ChemicalSolver::react(double t, double dt) -> void
-//{
-//    pimpl->react(t, dt);
-//}
-//
-//auto ChemicalSolver::state(Index i) const -> const ChemicalState&
-//{
-//    return pimpl->states[i];
-//}
-//
-//auto ChemicalSolver::states() const -> const std::vector<ChemicalState>&
-//{
-//    return pimpl->states;
-//}
-//
-//auto ChemicalSolver::componentAmounts() -> const std::vector<Vector>&
-//{
-//    pimpl->updateComponentAmounts();
-//    return pimpl->c;
-//}
-//
-//auto ChemicalSolver::equilibriumSpeciesAmounts() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateEquilibriumSpeciesAmounts();
-//    return pimpl->ne;
-//}
-//
-//auto ChemicalSolver::porosity() -> const ChemicalField&
-//{
-//    pimpl->updatePorosity();
-//    return pimpl->porosity;
-//}
-//
-//auto ChemicalSolver::fluidSaturations() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateFluidSaturations();
-//    return pimpl->fluid_saturations;
-//}
-//
-//auto ChemicalSolver::fluidDensities() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateFluidDensities();
-//    return pimpl->fluid_densities;
-//}
-//
-//auto ChemicalSolver::fluidVolumes() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateFluidVolumes();
-//    return pimpl->fluid_volumes;
-//}
-//
-//auto ChemicalSolver::fluidTotalVolume() -> const ChemicalField&
-//{
-//    pimpl->updateFluidTotalVolume();
-//    return pimpl->fluid_total_volume;
-//}
-//
-//auto ChemicalSolver::solidTotalVolume() -> const ChemicalField&
-//{
-//    pimpl->updateSolidTotalVolume();
-//    return pimpl->solid_total_volume;
-//}
-//
-//auto ChemicalSolver::componentRates() -> const std::vector<ChemicalField>&
-//{
-//    pimpl->updateComponentRates();
-//    return pimpl->rc;
-//}
-//
-//}  // namespace Reaktoro
+#include "ChemicalSolver.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
+#include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Core/Reaction.hpp>
+#include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Kinetics/KineticOptions.hpp>
+#include <Reaktoro/Kinetics/KineticSolver.hpp>
+#include <Reaktoro/Util/ChemicalScalarField.hpp>
+
+namespace Reaktoro {
+
+struct ChemicalSolver::Impl
+{
+    /// The solver and auxiliary data used by each thread in the calculations at the field points
+    struct Worker
+    {
+        /// The deep copy of the chemical system used by this worker
+        ChemicalSystem system;
+
+        /// The reaction system built with the chemical system of this worker
+        ReactionSystem reactions;
+
+        /// The equilibrium solver of this worker
+        EquilibriumSolver equilibriumsolver;
+
+        /// The amounts of the equilibrium elements at the current field point
+        Vector be;
+
+        /// The molar masses of the species (in units of kg/mol)
+        Vector molar_masses;
+
+        /// The volumes and densities of the phases at the current field point
+        ChemicalVector phase_volumes, phase_densities;
+
+        /// The kinetic rates of the reactions and of the components at the current field point
+        ChemicalVector reaction_rates, component_rates;
+
+        /// The total fluid volume, total solid volume and saturation of a fluid phase at the current field point
+        ChemicalScalar fluid_volume, solid_volume, saturation;
+
+        /// Construct a Worker instance with given chemical system, reactions and number of components
+        Worker(const ChemicalSystem& system, const std::vector<Reaction>& reactions, Index Ee, Index Nc)
+        : system(system),
+          reactions(system, reactions),
+          equilibriumsolver(system),
+          be(Ee),
+          molar_masses(system.numSpecies()),
+          phase_volumes(system.numPhases(), system.numSpecies()),
+          phase_densities(system.numPhases(), system.numSpecies()),
+          reaction_rates(reactions.size(), system.numSpecies()),
+          component_rates(Nc, system.numSpecies()),
+          fluid_volume(system.numSpecies()),
+          solid_volume(system.numSpecies()),
+          saturation(system.numSpecies())
+        {
+            for(Index i = 0; i < system.numSpecies(); ++i)
+                molar_masses[i] = system.species(i).molarMass();
+        }
+    };
+
+    /// The chemical system instance
+    ChemicalSystem system;
+
+    /// The reaction system instance
+    ReactionSystem reactions;
+
+    /// The number of field points
+    Index npoints = 0;
+
+    /// The partitioning of the chemical system
+    Partition partition;
+
+    /// The number of species and elements in the system
+    Index N = 0, E = 0;
+
+    /// The number of species and elements in the equilibrium partition
+    Index Ne = 0, Ee = 0, Nk = 0, Nfp = 0;
+
+    /// The number of components
+    Index Nc = 0;
+
+    /// The number of threads used in the calculations (zero for the number of hardware threads)
+    Index num_threads = 0;
+
+    /// The chemical states at each point in the field
+    std::vector<ChemicalState> states;
+
+    /// The kinetic solver
+    KineticSolver kineticsolver;
+
+    /// The workers used by each thread
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /// The formula matrix w.r.t. the equilibrium elements and equilibrium species
+    Matrix We;
+
+    /// The matrix that maps the reaction rates to the rates of the chemical components
+    Matrix A;
+
+    /// The molar amounts of the chemical components at every field point
+    std::vector<Vector> c;
+
+    /// The kinetic rates of the chemical components and their derivatives at every field point (in units of mol/s)
+    std::vector<ChemicalScalarField> rc;
+
+    /// The molar amounts of equilibrium species and their derivatives at every field point
+    std::vector<ChemicalScalarField> ne;
+
+    /// The porosity at every field point and their derivatives
+    ChemicalScalarField porosity;
+
+    /// The saturations of the fluid phases and their derivatives at every field point
+    std::vector<ChemicalScalarField> fluid_saturations;
+
+    /// The densities of the fluid phases and their derivatives at every field point (in units of kg/m3)
+    std::vector<ChemicalScalarField> fluid_densities;
+
+    /// The volumes of the fluid phases and their derivatives at every field point (in units of m3)
+    std::vector<ChemicalScalarField> fluid_volumes;
+
+    /// The total volume of the fluid phases and their derivatives at every field point (in units of m3)
+    ChemicalScalarField fluid_total_volume;
+
+    /// The total volume of the solid phases and their derivatives at every field point (in units of m3)
+    ChemicalScalarField solid_total_volume;
+
+    /// Construct a default Impl instance
+    Impl()
+    {}
+
+    /// Construct a custom Impl instance with given chemical system
+    Impl(const ChemicalSystem& system, Index npoints)
+    : system(system),
+      npoints(npoints),
+      states(npoints, ChemicalState(system))
+    {
+        setPartition(Partition(system));
+    }
+
+    /// Construct a custom Impl instance with given reaction system
+    Impl(const ReactionSystem& reactions, Index npoints)
+    : system(reactions.system()),
+      reactions(reactions),
+      npoints(npoints),
+      states(npoints, ChemicalState(system)),
+      kineticsolver(reactions)
+    {
+        setPartition(Partition(system));
+    }
+
+    /// Set the partition of the chemical system
+    auto setPartition(const Partition& partition_) -> void
+    {
+        // Set the partition of the chemical solver
+        partition = partition_;
+
+        // Initialize the number-type variables
+        N   = system.numSpecies();
+        E   = system.numElements();
+        Ne  = partition.numEquilibriumSpecies();
+        Nk  = partition.numKineticSpecies();
+        Nfp = partition.numFluidPhases();
+        Ee  = partition.numEquilibriumElements();
+        Nc  = Ee + Nk;
+
+        // Set the partition of the kinetic solver
+        if(Nk) kineticsolver.setPartition(partition);
+
+        // The indices of the equilibrium elements and equilibrium and kinetic species
+        const Indices& iee = partition.indicesEquilibriumElements();
+        const Indices& ies = partition.indicesEquilibriumSpecies();
+        const Indices& iks = partition.indicesKineticSpecies();
+
+        // The formula matrix w.r.t. the species and elements in the equilibrium partition
+        We = submatrix(system.formulaMatrix(), iee, ies);
+
+        // Initialise the coefficient matrix `A` that maps reaction rates to component rates
+        A.resize(Nc, reactions.numReactions());
+        if(reactions.numReactions())
+        {
+            const Matrix Se = cols(reactions.stoichiometricMatrix(), ies);
+            const Matrix Sk = cols(reactions.stoichiometricMatrix(), iks);
+            A.topRows(Ee) = We * tr(Se);
+            A.bottomRows(Nk) = tr(Sk);
+        }
+
+        // Allocate the chemical fields once for all field points
+        const ChemicalScalarField field(partition, npoints);
+        c.assign(Nc, zeros(npoints));
+        rc.assign(Nc, field);
+        ne.assign(Ne, field);
+        porosity = field;
+        fluid_saturations.assign(Nfp, field);
+        fluid_densities.assign(Nfp, field);
+        fluid_volumes.assign(Nfp, field);
+        fluid_total_volume = field;
+        solid_total_volume = field;
+
+        // The workers need to be created again with the new partition
+        workers.clear();
+    }
+
+    /// Set the number of threads used in the calculations
+    auto setNumThreads(Index val) -> void
+    {
+        num_threads = val;
+
+        KineticOptions options = kineticsolver.options();
+        options.batch.num_threads = val;
+        kineticsolver.setOptions(options);
+    }
+
+    /// Return the number of threads used in the calculations at the field points.
+    auto numThreads() const -> Index
+    {
+        // The calculations are performed in the calling thread only if the chemical system cannot be cloned
+        if(!system.cloneable())
+            return 1;
+
+        const Index nthreads = num_threads ? num_threads : std::thread::hardware_concurrency();
+        return std::max<Index>(1, std::min(nthreads, npoints));
+    }
+
+    /// Create the workers used by each thread in the calculations at the field points.
+    auto initializeWorkers(Index num_workers) -> void
+    {
+        while(workers.size() < num_workers)
+        {
+            // Each worker owns a deep copy of the chemical system so that its models are not evaluated concurrently
+            const ChemicalSystem worker_system = system.cloneable() ? system.clone() : system;
+
+            std::unique_ptr<Worker> worker(new Worker(worker_system, reactions.reactions(), Ee, Nc));
+            worker->equilibriumsolver.setPartition(partition);
+
+            workers.push_back(std::move(worker));
+        }
+    }
+
+    /// Apply a function `f(worker, k)` to every field point `k`, distributing the field points among the threads.
+    template<typename Function>
+    auto parallel(const Function& f) -> void
+    {
+        if(npoints == 0)
+            return;
+
+        // The number of threads used in the calculations
+        const Index nthreads = numThreads();
+
+        // Create the workers of the threads not yet created
+        initializeWorkers(nthreads);
+
+        // The index of the next field point to be processed by any thread
+        std::atomic<Index> next(0);
+
+        // The exceptions thrown in each thread, to be rethrown in the calling thread
+        std::vector<std::exception_ptr> errors(nthreads);
+
+        // The work of each thread, which processes one field point at a time until none remains
+        auto work = [&](Index ithread)
+        {
+            Worker& worker = *workers[ithread];
+            try
+            {
+                for(Index k = next++; k < npoints; k = next++)
+                    f(worker, k);
+            }
+            catch(...)
+            {
+                errors[ithread] = std::current_exception();
+                next = npoints;
+            }
+        };
+
+        // Start the additional threads and use the calling thread as the first one
+        std::vector<std::thread> threads;
+        for(Index ithread = 1; ithread < nthreads; ++ithread)
+            threads.emplace_back(work, ithread);
+        work(0);
+
+        for(std::thread& thread : threads)
+            thread.join();
+
+        for(const std::exception_ptr& error : errors)
+            if(error) std::rethrow_exception(error);
+    }
+
+    /// Equilibrate the chemical state at every field point.
+    auto equilibrate(Array<double> T, Array<double> P, Array<double> b) -> void
+    {
+        Assert(T.size == npoints,
+            "Could not perform equilibrium calculations.",
+            "Expecting the same number of temperature values as there are field points.");
+
+        Assert(P.size == npoints,
+            "Could not perform equilibrium calculations.",
+            "Expecting the same number of pressure values as there are field points.");
+
+        Assert(b.size == npoints * Ee,
+            "Could not perform equilibrium calculations.",
+            "Expecting, for each equilibrium element, the same number of amount "
+            "values as there are field points.");
+
+        parallel([&](Worker& worker, Index k)
+        {
+            worker.equilibriumsolver.solve(states[k], T.data[k], P.data[k], b.data + k*Ee);
+            update(worker, k, worker.equilibriumsolver.properties(), worker.equilibriumsolver.sensitivity());
+        });
+    }
+
+    /// Equilibrate the chemical state at every field point.
+    auto equilibrate(Array<double> T, Array<double> P, Grid<double> b) -> void
+    {
+        Assert(T.size == npoints,
+            "Could not perform equilibrium calculations.",
+            "Expecting the same number of temperature values as there are field points.");
+
+        Assert(P.size == npoints,
+            "Could not perform equilibrium calculations.",
+            "Expecting the same number of pressure values as there are field points.");
+
+        Assert(b.rows == Ee && b.cols == npoints,
+            "Could not perform equilibrium calculations.",
+            "Expecting, for each equilibrium element, the same number of amount "
+            "values as there are field points.");
+
+        parallel([&](Worker& worker, Index k)
+        {
+            for(Index j = 0; j < Ee; ++j)
+                worker.be[j] = b.row(j)[k];
+            worker.equilibriumsolver.solve(states[k], T.data[k], P.data[k], worker.be);
+            update(worker, k, worker.equilibriumsolver.properties(), worker.equilibriumsolver.sensitivity());
+        });
+    }
+
+    /// React the chemical state at every field point.
+    auto react(double t, double dt) -> void
+    {
+        Assert(reactions.numReactions(),
+            "Could not perform kinetic calculations.",
+            "Expecting a chemical solver constructed with a reaction system.");
+
+        // Create the workers of the threads used by the kinetic solver not yet created
+        initializeWorkers(kineticsolver.numThreads(npoints));
+
+        // Advance the chemical states concurrently with the kinetic solver, updating the chemical fields
+        // at every field point with the chemical properties and equilibrium sensitivity of its final state
+        kineticsolver.solve(states, t, dt, [&](Index ithread, Index k,
+            const ChemicalProperties& properties, const EquilibriumSensitivity& sensitivity)
+        {
+            update(*workers[ithread], k, properties, sensitivity);
+        });
+    }
+
+    /// Update the volumes and densities of the phases at a field point in the buffers of a worker.
+    auto updatePhaseVolumesAndDensities(Worker& worker, const ChemicalProperties& properties, VectorConstRef n) -> void
+    {
+        // The standard partial molar volumes of the species and the molar volumes of the phases
+        const auto v = properties.thermoModelResult().standardPartialMolarVolumes();
+        const auto vm = properties.chemicalModelResult().phaseMolarVolumes();
+
+        ChemicalVector& V = worker.phase_volumes;
+        ChemicalVector& rho = worker.phase_densities;
+
+        Index ispecies = 0;
+        for(Index iphase = 0; iphase < system.numPhases(); ++iphase)
+        {
+            const Index nspecies = system.numSpeciesInPhase(iphase);
+            const auto np = n.segment(ispecies, nspecies);
+            const auto mm = worker.molar_masses.segment(ispecies, nspecies);
+
+            // The volume of the phase, using the standard partial molar volumes of its species if the
+            // phase has no molar volume of its own (see ChemicalProperties::phaseMolarVolumes)
+            if(vm.val[iphase] > 0.0)
+            {
+                const double amount = np.sum();
+                V.val[iphase] = amount * vm.val[iphase];
+                V.ddT[iphase] = amount * vm.ddT[iphase];
+                V.ddP[iphase] = amount * vm.ddP[iphase];
+                V.ddn.row(iphase).noalias() = amount * vm.ddn.row(iphase);
+                V.ddn.row(iphase).segment(ispecies, nspecies).array() += vm.val[iphase];
+            }
+            else
+            {
+                V.val[iphase] = v.val.segment(ispecies, nspecies).dot(np);
+                V.ddT[iphase] = v.ddT.segment(ispecies, nspecies).dot(np);
+                V.ddP[iphase] = v.ddP.segment(ispecies, nspecies).dot(np);
+                V.ddn.row(iphase).setZero();
+                V.ddn.row(iphase).segment(ispecies, nspecies) = tr(v.val.segment(ispecies, nspecies));
+            }
+
+            // The density of the phase as the ratio of its mass and volume
+            rho.val[iphase] = mm.dot(np)/V.val[iphase];
+            rho.ddT[iphase] = -rho.val[iphase] * V.ddT[iphase]/V.val[iphase];
+            rho.ddP[iphase] = -rho.val[iphase] * V.ddP[iphase]/V.val[iphase];
+            rho.ddn.row(iphase).noalias() = (-rho.val[iphase]/V.val[iphase]) * V.ddn.row(iphase);
+            rho.ddn.row(iphase).segment(ispecies, nspecies) += tr(mm)/V.val[iphase];
+
+            ispecies += nspecies;
+        }
+    }
+
+    /// Update the chemical fields at a field point with its chemical properties and equilibrium sensitivity.
+    /// This method writes only into the buffers of the worker and the preallocated chemical fields.
+    auto update(Worker& worker, Index k, const ChemicalProperties& properties, const EquilibriumSensitivity& sensitivity) -> void
+    {
+        // The indices of the equilibrium and kinetic species
+        const Indices& ies = partition.indicesEquilibriumSpecies();
+        const Indices& iks = partition.indicesKineticSpecies();
+
+        // The indices of the fluid and solid phases
+        const Indices& ifp = partition.indicesFluidPhases();
+        const Indices& isp = partition.indicesSolidPhases();
+
+        // The molar amounts of all species
+        VectorConstRef n = states[k].speciesAmounts();
+
+        // Update the molar amounts of the chemical components
+        for(Index j = 0; j < Ee; ++j)
+        {
+            c[j][k] = 0.0;
+            for(Index i = 0; i < Ne; ++i)
+                c[j][k] += We(j, i) * n[ies[i]];
+        }
+        for(Index i = 0; i < Nk; ++i)
+            c[i + Ee][k] = n[iks[i]];
+
+        // Update the molar amounts of the equilibrium species and their sensitivities
+        for(Index i = 0; i < Ne; ++i)
+        {
+            ne[i].val()[k] = n[ies[i]];
+            ne[i].ddT()[k] = sensitivity.dndT[i];
+            ne[i].ddP()[k] = sensitivity.dndP[i];
+            for(Index j = 0; j < Ee; ++j)
+                ne[i].ddbe()[j][k] = sensitivity.dndb(i, j);
+        }
+
+        // Calculate the volumes and densities of all phases
+        updatePhaseVolumesAndDensities(worker, properties, n);
+
+        // Update the volumes and densities of the fluid phases and their total volume
+        worker.fluid_volume = 0.0;
+        for(Index j = 0; j < Nfp; ++j)
+        {
+            fluid_volumes[j].set(k, worker.phase_volumes[ifp[j]], sensitivity);
+            fluid_densities[j].set(k, worker.phase_densities[ifp[j]], sensitivity);
+            worker.fluid_volume += worker.phase_volumes[ifp[j]];
+        }
+        fluid_total_volume.set(k, worker.fluid_volume, sensitivity);
+
+        // Update the saturations of the fluid phases
+        const ChemicalScalar& Vf = worker.fluid_volume;
+        const ChemicalVector& V = worker.phase_volumes;
+        ChemicalScalar& s = worker.saturation;
+        for(Index j = 0; j < Nfp; ++j)
+        {
+            const Index iphase = ifp[j];
+            s.val = V.val[iphase]/Vf.val;
+            s.ddT = (V.ddT[iphase] - s.val * Vf.ddT)/Vf.val;
+            s.ddP = (V.ddP[iphase] - s.val * Vf.ddP)/Vf.val;
+            s.ddn.noalias() = (V.ddn.row(iphase) - s.val * Vf.ddn)/Vf.val;
+            fluid_saturations[j].set(k, s, sensitivity);
+        }
+
+        // Update the total volume of the solid phases and the porosity
+        worker.solid_volume = 0.0;
+        for(Index iphase : isp)
+            worker.solid_volume += worker.phase_volumes[iphase];
+        solid_total_volume.set(k, worker.solid_volume, sensitivity);
+        worker.solid_volume *= -1.0;
+        worker.solid_volume += 1.0;
+        porosity.set(k, worker.solid_volume, sensitivity);
+
+        // Update the kinetic rates of the chemical components
+        if(A.cols())
+        {
+            ChemicalVector& r = worker.reaction_rates;
+            for(Index i = 0; i < r.size(); ++i)
+                r[i] = worker.reactions.reaction(i).rate(properties);
+            ChemicalVector& rates = worker.component_rates;
+            rates.val.noalias() = A * r.val;
+            rates.ddT.noalias() = A * r.ddT;
+            rates.ddP.noalias() = A * r.ddP;
+            rates.ddn.noalias() = A * r.ddn;
+            for(Index j = 0; j < Nc; ++j)
+                rc[j].set(k, rates[j], sensitivity);
+        }
+    }
+};
+
+ChemicalSolver::ChemicalSolver()
+: pimpl(new Impl())
+{}
+
+ChemicalSolver::ChemicalSolver(const ChemicalSystem& system, Index npoints)
+: pimpl(new Impl(system, npoints))
+{}
+
+ChemicalSolver::ChemicalSolver(const ReactionSystem& reactions, Index npoints)
+: pimpl(new Impl(reactions, npoints))
+{}
+
+auto ChemicalSolver::numPoints() const -> Index
+{
+    return pimpl->npoints;
+}
+
+auto ChemicalSolver::numEquilibriumElements() const -> Index
+{
+    return pimpl->Ee;
+}
+
+auto ChemicalSolver::numKineticSpecies() const -> Index
+{
+    return pimpl->Nk;
+}
+
+auto ChemicalSolver::numComponents() const -> Index
+{
+    return pimpl->Nc;
+}
+
+auto ChemicalSolver::setPartition(const Partition& partition) -> void
+{
+    pimpl->setPartition(partition);
+}
+
+auto ChemicalSolver::setNumThreads(Index num_threads) -> void
+{
+    pimpl->setNumThreads(num_threads);
+}
+
+auto ChemicalSolver::setStates(const ChemicalState& state) -> void
+{
+    for(Index k = 0; k < pimpl->npoints; ++k)
+        pimpl->states[k] = state;
+}
+
+auto ChemicalSolver::setStates(const Array<ChemicalState>& states) -> void
+{
+    Assert(states.size == pimpl->npoints,
+        "Could not set the chemical states at every field point.",
+        "Expecting the same number of chemical states as there are field points.");
+    for(Index k = 0; k < states.size; ++k)
+        pimpl->states[k] = states.data[k];
+}
+
+auto ChemicalSolver::setStateAt(Index ipoint, const ChemicalState& state) -> void
+{
+    Assert(ipoint < pimpl->npoints,
+        "Could not set the chemical state at given field point.",
+        "Expecting a field point index smaller than the number of field points.");
+    pimpl->states[ipoint] = state;
+}
+
+auto ChemicalSolver::setStateAt(const Array<Index>& ipoints, const ChemicalState& state) -> void
+{
+    Assert(ipoints.size <= pimpl->npoints,
+        "Could not set the chemical state at given field points.",
+        "Expecting number of indices not greater than the number of field points.");
+    for(Index k = 0; k < ipoints.size; ++k)
+        setStateAt(ipoints.data[k], state);
+}
+
+auto ChemicalSolver::setStateAt(const Array<Index>& ipoints, const Array<ChemicalState>& states) -> void
+{
+    Assert(ipoints.size <= pimpl->npoints,
+        "Could not set the chemical state at given field points.",
+        "Expecting number of indices not greater than the number of field points.");
+    Assert(ipoints.size == states.size,
+        "Could not set the chemical state at given field points.",
+        "Expecting the same number of field point indices and chemical states.");
+    for(Index k = 0; k < ipoints.size; ++k)
+        setStateAt(ipoints.data[k], states.data[k]);
+}
+
+auto ChemicalSolver::equilibrate(Array<double> T, Array<double> P, Array<double> be) -> void
+{
+    pimpl->equilibrate(T, P, be);
+}
+
+auto ChemicalSolver::equilibrate(Array<double> T, Array<double> P, Grid<double> be) -> void
+{
+    pimpl->equilibrate(T, P, be);
+}
+
+auto ChemicalSolver::react(double t, double dt) -> void
+{
+    pimpl->react(t, dt);
+}
+
+auto ChemicalSolver::state(Index i) const -> const ChemicalState&
+{
+    return pimpl->states[i];
+}
+
+auto ChemicalSolver::states() const -> const std::vector<ChemicalState>&
+{
+    return pimpl->states;
+}
+
+auto ChemicalSolver::componentAmounts() const -> const std::vector<Vector>&
+{
+    return pimpl->c;
+}
+
+auto ChemicalSolver::equilibriumSpeciesAmounts() const -> const std::vector<ChemicalScalarField>&
+{
+    return pimpl->ne;
+}
+
+auto ChemicalSolver::porosity() const -> const ChemicalScalarField&
+{
+    return pimpl->porosity;
+}
+
+auto ChemicalSolver::fluidSaturations() const -> const std::vector<ChemicalScalarField>&
+{
+    return pimpl->fluid_saturations;
+}
+
+auto ChemicalSolver::fluidDensities() const -> const std::vector<ChemicalScalarField>&
+{
+    return pimpl->fluid_densities;
+}
+
+auto ChemicalSolver::fluidVolumes() const -> const std::vector<ChemicalScalarField>&
+{
+    return pimpl->fluid_volumes;
+}
+
+auto ChemicalSolver::fluidTotalVolume() const -> const ChemicalScalarField&
+{
+    return pimpl->fluid_total_volume;
+}
+
+auto ChemicalSolver::solidTotalVolume() const -> const ChemicalScalarField&
+{
+    return pimpl->solid_total_volume;
+}
+
+auto ChemicalSolver::componentRates() const -> const std::vector<ChemicalScalarField>&
+{
+    return pimpl->rc;
+}
+
+} // namespace Reaktoro
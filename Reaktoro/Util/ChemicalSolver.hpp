@@ -15,202 +15,224 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 //
-//#pragma once
-//
-//// C++ includes
-//#include <memory>
-//#include <string>
-//
-//// Reaktoro includes
-//#include <Reaktoro/Common/Index.hpp>
-//#include <Reaktoro/Math/Matrix.hpp>
-//
-//namespace Reaktoro {
-//
-//// Forward declarations
-//class ChemicalField;
-//class ChemicalSystem;
-//class ChemicalState;
-//class Partition;
-//class ReactionSystem;
-//
-///// A type that describes a solver for many chemical calculations.
-//class ChemicalSolver
-//{
-//public:
-//    // Forward declaration of the Array type.
-//    template<typename T>
-//    class Array;
-//
-//    // Forward declaration of the Grid type.
-//    template<typename T>
-//    class Grid;
-//
-//    /// Construct a default ChemicalSolver instance.
-//    ChemicalSolver();
-//
-//    /// Construct a ChemicalSolver instance with given chemical system and field number of points.
-//    ChemicalSolver(const ChemicalSystem& system, Index npoints);
-//
-//    /// Construct a ChemicalSolver instance with given reaction system and field number of points.
-//    ChemicalSolver(const ReactionSystem& reactions, Index npoints);
-//
-//    /// Return the number of field points.
-//    auto numPoints() const -> Index;
-//
-//    /// Return the number of equilibrium elements.
-//    auto numEquilibriumElements() const -> Index;
-//
-//    /// Return the number of kinetic species.
-//    auto numKineticSpecies() const -> Index;
-//
-//    /// Return the number of chemical components.
-//    auto numComponents() const -> Index;
-//
-//    /// Set the partitioning of the chemical system.
-//    auto setPartition(const Partition& partition) -> void;
-//
-//    /// Set the chemical state of all field points uniformly.
-//    /// @param state The state of the chemical system.
-//    auto setStates(const ChemicalState& state) -> void;
-//
-//    /// Set the chemical state of all field points.
-//    /// @param states The array of states of the chemical system.
-//    auto setStates(const Array<ChemicalState>& states) -> void;
-//
-//    /// Set the chemical state at a specified field point.
-//    /// @param ipoint The index of the field point.
-//    /// @param state The state of the chemical system.
-//    auto setStateAt(Index ipoint, const ChemicalState& state) -> void;
-//
-//    /// Set the same chemical state at all specified field points.
-//    /// @param ipoints The indices of the field points.
-//    /// @param state The state of the chemical system.
-//    auto setStateAt(const Array<Index>& ipoints, const ChemicalState& state) -> void;
-//
-//    /// Set the chemical state at all specified field points.
-//    /// @param ipoints The indices of the field points.
-//    /// @param states The states of the chemical system.
-//    auto setStateAt(const Array<Index>& ipoints, const Array<ChemicalState>& states) -> void;
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Array<double> be) -> void;
-//
-//    /// Equilibrate the chemical state at every field point.
-//    auto equilibrate(Array<double> T, Array<double> P, Grid<double> be) -> void;
-//
-//    /// React the chemical state at every field point.
-//    auto react(double t, double dt) -> void;
-//
-//    /// Return the chemical state at given index.
-//    auto state(Index i) const -> const ChemicalState&;
-//
-//    /// Return the chemical states at all field points.
-//    auto states() const -> const std::vector<ChemicalState>&;
-//
-//    /// Return the molar amounts of the chemical components at every field point (in units of mol).
-//    auto componentAmounts() -> const std::vector<Vector>&;
-//
-//    /// Return the molar amounts of each equilibrium species and their derivatives at every field point.
-//    auto equilibriumSpeciesAmounts() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the porosity at every field point.
-//    auto porosity() -> const ChemicalField&;
-//
-//    /// Return the saturations of the fluid phases at every field point.
-//    auto fluidSaturations() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the densities of the fluid phases at every field point (in units of kg/m3).
-//    auto fluidDensities() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the volumes of the fluid phases at every field point (in units of m3).
-//    auto fluidVolumes() -> const std::vector<ChemicalField>&;
-//
-//    /// Return the total volume of the fluid phases at every field point (in units of m3).
-//    auto fluidTotalVolume() -> const ChemicalField&;
-//
-//    /// Return the total volume of the solid phases at every field point (in units of m3).
-//    auto solidTotalVolume() -> const ChemicalField&;
-//
-//    /// Return the kinetic rates of the chemical components at every field point (in units of mol/s).
-//    auto componentRates() -> const std::vector<ChemicalField>&;
-//
-//private:
-//    struct Impl;
-//
-//    std::shared_ptr<Impl> pimpl;
-//
-//public:
-//    /// A type that represents a one-dimensional array of values.
-//    template<typename T>
-//    class Array
-//    {
-//    public:
-//        /// Construct a default Array instance.
-//        Array()
-//        {}
-//
-//        /// Construct a custom Array instance.
-//        Array(const T* data, Index size)
-//        : data(data), size(size) {}
-//
-//        /// Construct an Array instance from a vector-like instance.
-//        /// The type of the vector must have public methods `data` and `size`.
-//        template<typename VectorType>
-//        Array(const VectorType& vec)
-//        : data(vec.data()), size(vec.size()) {}
-//
-//        friend class ChemicalSolver;
-//
-//    private:
-//        /// The pointer to a one-dimensional array of values.
-//        const T* data = nullptr;
-//
-//        /// The size of the array.
-//        Index size = 0;
-//    };
-//
-//    /// A type that represents a two-dimensional array of values.
-//    template<typename T>
-//    class Grid
-//    {
-//    public:
-//        /// Construct a default Grid instance.
-//        Grid()
-//        {}
-//
-//        /// Construct a custom Grid instance.
-//        Grid(const T** data, Index rows, Index cols)
-//        : data(data), rows(rows), cols(cols) {}
-//
-//        /// Construct an Grid instance from a vector-like instance.
-//        /// The type of the vector must have public methods `data` and `size`.
-//        template<typename VectorType>
-//        Grid(const std::vector<VectorType>& vec)
-//        {
-//            pointers.reserve(vec.size());
-//            for(const VectorType& v : vec)
-//                pointers.push_back(v.data());
-//            rows = vec.size();
-//            cols = vec.front().size();
-//        }
-//
-//        friend class ChemicalSolver;
-//
-//    private:
-//        /// The pointer to a two-dimensional array of values.
-//        const T** data = nullptr;
-//
-//        /// The pointer to a two-dimensional array of values.
-//        std::vector<const T*> pointers;
-//
-//        /// The number of rows of the grid.
-//        Index rows = 0;
-//
-//        /// The number of columns of the grid.
-//        Index cols = 0;
-//    };
-//};
-//
-//} // namespace Reaktoro
-//
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalScalarField;
+class ChemicalSystem;
+class ChemicalState;
+class Partition;
+class ReactionSystem;
+
+/// A type that describes a solver for many chemical calculations.
+/// The chemical calculations at the field points are performed concurrently, with each thread
+/// using its own equilibrium solver and its own copy of the chemical system. After every
+/// calculation, the chemical fields (e.g., porosity, saturations and densities of the fluid
+/// phases) and their derivatives with respect to temperature, pressure, and amounts of the
+/// equilibrium elements and kinetic species are updated at every field point, using storage
+/// allocated once for all field points. A ChemicalSolver instance cannot be used concurrently
+/// in different threads, since its calculations already use threads of their own.
+class ChemicalSolver
+{
+public:
+    // Forward declaration of the Array type.
+    template<typename T>
+    class Array;
+
+    // Forward declaration of the Grid type.
+    template<typename T>
+    class Grid;
+
+    /// Construct a default ChemicalSolver instance.
+    ChemicalSolver();
+
+    /// Construct a ChemicalSolver instance with given chemical system and field number of points.
+    ChemicalSolver(const ChemicalSystem& system, Index npoints);
+
+    /// Construct a ChemicalSolver instance with given reaction system and field number of points.
+    ChemicalSolver(const ReactionSystem& reactions, Index npoints);
+
+    /// Return the number of field points.
+    auto numPoints() const -> Index;
+
+    /// Return the number of equilibrium elements.
+    auto numEquilibriumElements() const -> Index;
+
+    /// Return the number of kinetic species.
+    auto numKineticSpecies() const -> Index;
+
+    /// Return the number of chemical components.
+    auto numComponents() const -> Index;
+
+    /// Set the partitioning of the chemical system.
+    auto setPartition(const Partition& partition) -> void;
+
+    /// Set the number of threads used in the chemical calculations (zero for the number of hardware threads).
+    auto setNumThreads(Index num_threads) -> void;
+
+    /// Set the chemical state of all field points uniformly.
+    /// @param state The state of the chemical system.
+    auto setStates(const ChemicalState& state) -> void;
+
+    /// Set the chemical state of all field points.
+    /// @param states The array of states of the chemical system.
+    auto setStates(const Array<ChemicalState>& states) -> void;
+
+    /// Set the chemical state at a specified field point.
+    /// @param ipoint The index of the field point.
+    /// @param state The state of the chemical system.
+    auto setStateAt(Index ipoint, const ChemicalState& state) -> void;
+
+    /// Set the same chemical state at all specified field points.
+    /// @param ipoints The indices of the field points.
+    /// @param state The state of the chemical system.
+    auto setStateAt(const Array<Index>& ipoints, const ChemicalState& state) -> void;
+
+    /// Set the chemical state at all specified field points.
+    /// @param ipoints The indices of the field points.
+    /// @param states The states of the chemical system.
+    auto setStateAt(const Array<Index>& ipoints, const Array<ChemicalState>& states) -> void;
+
+    /// Equilibrate the chemical state at every field point.
+    /// @param T The temperatures at every field point (in units of K)
+    /// @param P The pressures at every field point (in units of Pa)
+    /// @param be The amounts of the equilibrium elements, stored contiguously for each field point (in units of mol)
+    auto equilibrate(Array<double> T, Array<double> P, Array<double> be) -> void;
+
+    /// Equilibrate the chemical state at every field point.
+    /// @param T The temperatures at every field point (in units of K)
+    /// @param P The pressures at every field point (in units of Pa)
+    /// @param be The amounts of the equilibrium elements, one row for each equilibrium element (in units of mol)
+    auto equilibrate(Array<double> T, Array<double> P, Grid<double> be) -> void;
+
+    /// React the chemical state at every field point.
+    /// The chemical fields are updated with the chemical properties and equilibrium sensitivity
+    /// of the last equilibrium calculation of the kinetic solver at every field point, so that
+    /// the reacted chemical states are not equilibrated once more.
+    auto react(double t, double dt) -> void;
+
+    /// Return the chemical state at given index.
+    auto state(Index i) const -> const ChemicalState&;
+
+    /// Return the chemical states at all field points.
+    auto states() const -> const std::vector<ChemicalState>&;
+
+    /// Return the molar amounts of the chemical components at every field point (in units of mol).
+    auto componentAmounts() const -> const std::vector<Vector>&;
+
+    /// Return the molar amounts of each equilibrium species and their derivatives at every field point.
+    auto equilibriumSpeciesAmounts() const -> const std::vector<ChemicalScalarField>&;
+
+    /// Return the porosity at every field point.
+    auto porosity() const -> const ChemicalScalarField&;
+
+    /// Return the saturations of the fluid phases at every field point.
+    auto fluidSaturations() const -> const std::vector<ChemicalScalarField>&;
+
+    /// Return the densities of the fluid phases at every field point (in units of kg/m3).
+    auto fluidDensities() const -> const std::vector<ChemicalScalarField>&;
+
+    /// Return the volumes of the fluid phases at every field point (in units of m3).
+    auto fluidVolumes() const -> const std::vector<ChemicalScalarField>&;
+
+    /// Return the total volume of the fluid phases at every field point (in units of m3).
+    auto fluidTotalVolume() const -> const ChemicalScalarField&;
+
+    /// Return the total volume of the solid phases at every field point (in units of m3).
+    auto solidTotalVolume() const -> const ChemicalScalarField&;
+
+    /// Return the kinetic rates of the chemical components at every field point (in units of mol/s).
+    auto componentRates() const -> const std::vector<ChemicalScalarField>&;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+
+public:
+    /// A type that represents a one-dimensional array of values.
+    template<typename T>
+    class Array
+    {
+    public:
+        /// Construct a default Array instance.
+        Array()
+        {}
+
+        /// Construct a custom Array instance.
+        Array(const T* data, Index size)
+        : data(data), size(size) {}
+
+        /// Construct an Array instance from a vector-like instance.
+        /// The type of the vector must have public methods `data` and `size`.
+        template<typename VectorType>
+        Array(const VectorType& vec)
+        : data(vec.data()), size(vec.size()) {}
+
+        friend class ChemicalSolver;
+
+    private:
+        /// The pointer to a one-dimensional array of values.
+        const T* data = nullptr;
+
+        /// The size of the array.
+        Index size = 0;
+    };
+
+    /// A type that represents a two-dimensional array of values.
+    template<typename T>
+    class Grid
+    {
+    public:
+        /// Construct a default Grid instance.
+        Grid()
+        {}
+
+        /// Construct a custom Grid instance.
+        Grid(const T** data, Index rows, Index cols)
+        : data(data), rows(rows), cols(cols) {}
+
+        /// Construct an Grid instance from a vector-like instance.
+        /// The type of the vector must have public methods `data` and `size`.
+        template<typename VectorType>
+        Grid(const std::vector<VectorType>& vec)
+        {
+            pointers.reserve(vec.size());
+            for(const VectorType& v : vec)
+                pointers.push_back(v.data());
+            rows = vec.size();
+            cols = vec.empty() ? 0 : vec.front().size();
+        }
+
+        friend class ChemicalSolver;
+
+    private:
+        /// Return the pointer to the values in a row of the grid.
+        auto row(Index i) const -> const T* { return pointers.empty() ? data[i] : pointers[i]; }
+
+        /// The pointer to a two-dimensional array of values.
+        const T** data = nullptr;
+
+        /// The pointers to the rows of the grid, if constructed from a vector of vector-like instances.
+        std::vector<const T*> pointers;
+
+        /// The number of rows of the grid.
+        Index rows = 0;
+
+        /// The number of columns of the grid.
+        Index cols = 0;
+    };
+};
+
+} // namespace Reaktoro
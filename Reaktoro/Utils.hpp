@@ -17,5 +17,5 @@
 
 #pragma once
 
-#include <Reaktoro/Util/ChemicalField.hpp>
+#include <Reaktoro/Util/ChemicalScalarField.hpp>
 #include <Reaktoro/Util/ChemicalSolver.hpp>
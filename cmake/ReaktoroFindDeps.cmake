@@ -1,6 +1,9 @@
 # Find Boost library
 find_package(Boost REQUIRED)
 
+# Find the threads library of the platform (e.g., pthreads)
+find_package(Threads REQUIRED)
+
 # Find pybind11 library (if needed) https://github.com/pybind/pybind11
 if(REAKTORO_BUILD_PYTHON)
 
@@ -26,6 +26,12 @@ namespace Reaktoro {
 
 void exportMatrix(py::module& m)
 {
+    // The Vector and Matrix types are not exported as classes, since the type casters in
+    // pybind11/eigen.h convert them to and from numpy arrays. Methods that return VectorRef,
+    // MatrixRef or MatrixRowMajorRef (e.g., the arrays of ChemicalStateField) are bound with
+    // py::return_value_policy::reference_internal, so that they return numpy arrays that are
+    // views of the data of their objects instead of copies. Arguments of type VectorConstRef
+    // and MatrixRowMajorConstRef accept C-contiguous numpy arrays of float64 without copies.
 }
 
 } // namespace Reaktoro
@@ -26,6 +26,7 @@ namespace py = pybind11;
 // Reaktoro includes
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Connectivity.hpp>
 #include <Reaktoro/Core/ThermoProperties.hpp>
 #include <Reaktoro/Interfaces/Gems.hpp>
 #include <Reaktoro/Interfaces/Phreeqc.hpp>
@@ -55,6 +56,8 @@ void exportChemicalSystem(py::module& m)
     py::class_<ChemicalSystem>(m, "ChemicalSystem")
         .def(py::init<>())
         .def(py::init<const std::vector<Phase>&>())
+        .def(py::init<const std::vector<Phase>&, const ThermoModel&, const ChemicalModel&>())
+        .def(py::init<const std::vector<Phase>&, const ThermoModel&, const ChemicalModel&, bool>())
         .def(py::init([](const ChemicalEditor& editor) { return std::make_unique<ChemicalSystem>(editor); }))
         .def(py::init([](Gems& gems) { return std::make_unique<ChemicalSystem>(gems); }))
         .def(py::init([](Phreeqc& phreeqc) { return std::make_unique<ChemicalSystem>(phreeqc); }))
@@ -69,6 +72,7 @@ void exportChemicalSystem(py::module& m)
         .def("thermoModel", &ChemicalSystem::thermoModel, py::return_value_policy::reference_internal)
         .def("chemicalModel", &ChemicalSystem::chemicalModel, py::return_value_policy::reference_internal)
         .def("formulaMatrix", &ChemicalSystem::formulaMatrix, py::return_value_policy::reference_internal)
+        .def("connectivity", &ChemicalSystem::connectivity, py::return_value_policy::reference_internal)
         .def("element", element1, py::return_value_policy::reference_internal)
         .def("element", element2, py::return_value_policy::reference_internal)
         .def("species", species2, py::return_value_policy::reference_internal)
@@ -104,6 +108,8 @@ void exportChemicalSystem(py::module& m)
         .def("elementAmountInSpecies", &ChemicalSystem::elementAmountInSpecies)
         .def("properties", properties1)
         .def("properties", properties2)
+        .def("cloneable", &ChemicalSystem::cloneable)
+        .def("clone", &ChemicalSystem::clone)
         .def("__repr__", [](const ChemicalSystem& self) { std::stringstream ss; ss << self; return ss.str(); })
         ;
 }
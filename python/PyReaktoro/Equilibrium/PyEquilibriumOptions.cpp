@@ -31,6 +31,7 @@ void exportEquilibriumOptions(py::module& m)
         .value("ExactDiagonal", GibbsHessian::ExactDiagonal)
         .value("Approximation", GibbsHessian::Approximation)
         .value("ApproximationDiagonal", GibbsHessian::ApproximationDiagonal)
+        .value("ExactDiagonalLowRank", GibbsHessian::ExactDiagonalLowRank)
         ;
 
     py::class_<SmartEquilibriumOptions>(m, "SmartEquilibriumOptions")
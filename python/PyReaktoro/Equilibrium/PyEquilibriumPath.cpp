@@ -31,20 +31,33 @@ namespace Reaktoro {
 
 void exportEquilibriumPath(py::module& m)
 {
+    py::class_<EquilibriumPathContinuationOptions>(m, "EquilibriumPathContinuationOptions")
+        .def(py::init<>())
+        .def_readwrite("active", &EquilibriumPathContinuationOptions::active)
+        .def_readwrite("initial_step", &EquilibriumPathContinuationOptions::initial_step)
+        .def_readwrite("min_step", &EquilibriumPathContinuationOptions::min_step)
+        .def_readwrite("tolerance", &EquilibriumPathContinuationOptions::tolerance)
+        .def_readwrite("phase_tolerance", &EquilibriumPathContinuationOptions::phase_tolerance)
+        ;
+
     py::class_<EquilibriumPathOptions>(m, "EquilibriumPathOptions")
+        .def(py::init<>())
         .def_readwrite("equilibrium", &EquilibriumPathOptions::equilibrium)
         .def_readwrite("ode", &EquilibriumPathOptions::ode)
+        .def_readwrite("continuation", &EquilibriumPathOptions::continuation)
         ;
 
     py::class_<EquilibriumPathResult>(m, "EquilibriumPathResult")
         .def_readwrite("equilibrium", &EquilibriumPathResult::equilibrium)
+        .def_readwrite("num_steps", &EquilibriumPathResult::num_steps)
+        .def_readwrite("num_inaccurate_steps", &EquilibriumPathResult::num_inaccurate_steps)
         ;
 
     py::class_<EquilibriumPath>(m, "EquilibriumPath")
         .def(py::init<const ChemicalSystem&>())
         .def("setOptions", &EquilibriumPath::setOptions)
         .def("setPartition", &EquilibriumPath::setPartition)
-        .def("solve", &EquilibriumPath::solve)
+        .def("solve", &EquilibriumPath::solve, py::call_guard<py::gil_scoped_release>())
         .def("output", &EquilibriumPath::output)
         .def("plot", &EquilibriumPath::plot)
         .def("plots", &EquilibriumPath::plots)
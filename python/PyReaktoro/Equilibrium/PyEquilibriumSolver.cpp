@@ -18,9 +18,11 @@
 // pybind11 includes
 #include <pybind11/pybind11.h>
 #include <pybind11/eigen.h>
+#include <pybind11/stl.h>
 namespace py = pybind11;
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -30,9 +32,29 @@ namespace py = pybind11;
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
 
 namespace Reaktoro {
 
+/// Solve the equilibrium problems of all chemical states in a field, with one row of amounts of elements per state.
+/// The chemical states are updated in place.
+auto EquilibriumSolver_solveField(EquilibriumSolver& self, ChemicalStateField& field, MatrixRowMajorConstRef be) -> std::vector<EquilibriumResult>
+{
+    Assert(Index(be.rows()) == field.size() && Index(be.cols()) == field.system().numElements(),
+        "Could not solve the equilibrium problems of the chemical states in the field.",
+        "The given amounts of elements must have one row per chemical state and one column per element.");
+
+    const auto T = field.temperatures();
+    const auto P = field.pressures();
+
+    std::vector<EquilibriumResult> results(field.size());
+
+    for(Index i = 0; i < field.size(); ++i)
+        results[i] = self.solve(field.view(i), T[i], P[i], be.row(i));
+
+    return results;
+}
+
 void exportEquilibriumSolver(py::module& m)
 {
     auto solve1 = static_cast<EquilibriumResult(EquilibriumSolver::*)(ChemicalState&, double, double, VectorConstRef)>(&EquilibriumSolver::solve);
@@ -48,13 +70,14 @@ void exportEquilibriumSolver(py::module& m)
         .def(py::init<const ChemicalSystem&>())
         .def("setOptions", &EquilibriumSolver::setOptions)
         .def("setPartition", &EquilibriumSolver::setPartition)
-        .def("approximate", approximate1)
-        .def("approximate", approximate2)
-        .def("approximate", approximate3)
-        .def("solve", solve1)
-        .def("solve", solve2)
-        .def("solve", solve3)
-        .def("solve", solve4)
+        .def("approximate", approximate1, py::call_guard<py::gil_scoped_release>())
+        .def("approximate", approximate2, py::call_guard<py::gil_scoped_release>())
+        .def("approximate", approximate3, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve1, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve2, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve3, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve4, py::call_guard<py::gil_scoped_release>())
+        .def("solve", EquilibriumSolver_solveField, py::call_guard<py::gil_scoped_release>())
         .def("properties", &EquilibriumSolver::properties, py::return_value_policy::reference_internal)
         .def("sensitivity", &EquilibriumSolver::sensitivity, py::return_value_policy::reference_internal)
 //        .def("dndT", &EquilibriumSolver::dndT, py::return_value_policy::reference_internal)
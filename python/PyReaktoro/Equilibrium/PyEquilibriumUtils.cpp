@@ -47,18 +47,18 @@ void exportEquilibriumUtils(py::module& m)
     auto equilibrate11 = static_cast<ChemicalState (*)(const EquilibriumInverseProblem&)>(equilibrate);
     auto equilibrate12 = static_cast<ChemicalState (*)(const EquilibriumInverseProblem&, const EquilibriumOptions&)>(equilibrate);
 
-    m.def("equilibrate", equilibrate1);
-    m.def("equilibrate", equilibrate2);
-    m.def("equilibrate", equilibrate3);
-    m.def("equilibrate", equilibrate4);
-    m.def("equilibrate", equilibrate5);
-    m.def("equilibrate", equilibrate6);
-    m.def("equilibrate", equilibrate7);
-    m.def("equilibrate", equilibrate8);
-    m.def("equilibrate", equilibrate9);
-    m.def("equilibrate", equilibrate10);
-    m.def("equilibrate", equilibrate11);
-    m.def("equilibrate", equilibrate12);
+    m.def("equilibrate", equilibrate1, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate2, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate3, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate4, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate5, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate6, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate7, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate8, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate9, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate10, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate11, py::call_guard<py::gil_scoped_release>());
+    m.def("equilibrate", equilibrate12, py::call_guard<py::gil_scoped_release>());
 }
 
 } // namespace Reaktoro
@@ -28,7 +28,9 @@ namespace Reaktoro {
 void exportGems(py::module& m)
 {
     py::class_<GemsOptions>(m, "GemsOptions")
+        .def(py::init<>())
         .def_readwrite("warmstart", &GemsOptions::warmstart)
+        .def_readwrite("activity_coefficient_derivatives", &GemsOptions::activity_coefficient_derivatives)
         ;
 
     py::class_<Gems, Interface>(m, "Gems")
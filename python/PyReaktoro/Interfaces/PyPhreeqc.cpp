@@ -32,9 +32,15 @@ void exportPhreeqc(py::module& m)
 	auto execute1 = static_cast<void(Phreeqc::*)(std::string,std::string)>(&Phreeqc::execute);
 	auto execute2 = static_cast<void(Phreeqc::*)(std::string)>(&Phreeqc::execute);
 
+    py::class_<PhreeqcOptions>(m, "PhreeqcOptions")
+        .def(py::init<>())
+        .def_readwrite("activity_coefficient_derivatives", &PhreeqcOptions::activity_coefficient_derivatives)
+        ;
+
     py::class_<Phreeqc, Interface>(m, "Phreeqc")
         .def(py::init<>())
         .def(py::init<std::string>())
+        .def("setOptions", &Phreeqc::setOptions)
         .def("load", &Phreeqc::load)
         .def("execute", execute1)
         .def("execute", execute2)
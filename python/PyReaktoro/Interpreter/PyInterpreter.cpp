@@ -31,8 +31,8 @@ void exportInterpreter(py::module& m)
 {
     py::class_<Interpreter>(m, "Interpreter")
         .def(py::init<>())
-        .def("executeJsonString", &Interpreter::executeJsonString)
-        .def("executeJsonFile", &Interpreter::executeJsonFile)
+        .def("executeJsonString", &Interpreter::executeJsonString, py::call_guard<py::gil_scoped_release>())
+        .def("executeJsonFile", &Interpreter::executeJsonFile, py::call_guard<py::gil_scoped_release>())
         .def("system", &Interpreter::system, py::return_value_policy::reference_internal)
         .def("states", &Interpreter::states, py::return_value_policy::reference_internal)
         .def("state", &Interpreter::state, py::return_value_policy::reference_internal)
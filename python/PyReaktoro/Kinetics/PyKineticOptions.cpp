@@ -31,11 +31,41 @@ void exportKineticOptions(py::module& m)
         .def_readwrite("format", &KineticOutputOptions::format)
         ;
 
+    py::enum_<KineticJacobian>(m, "KineticJacobian")
+        .value("Sensitivity", KineticJacobian::Sensitivity)
+        .value("FiniteDifference", KineticJacobian::FiniteDifference)
+        ;
+
+    py::class_<KineticJacobianOptions>(m, "KineticJacobianOptions")
+        .def(py::init<>())
+        .def_readwrite("mode", &KineticJacobianOptions::mode)
+        .def_readwrite("max_sensitivity_age", &KineticJacobianOptions::max_sensitivity_age)
+        .def_readwrite("fdstep", &KineticJacobianOptions::fdstep)
+        .def_readwrite("coloring", &KineticJacobianOptions::coloring)
+        ;
+
+    py::class_<KineticBatchOptions>(m, "KineticBatchOptions")
+        .def(py::init<>())
+        .def_readwrite("num_threads", &KineticBatchOptions::num_threads)
+        .def_readwrite("negligible_rates_factor", &KineticBatchOptions::negligible_rates_factor)
+        ;
+
+    py::class_<SmartKineticOptions>(m, "SmartKineticOptions")
+        .def(py::init<>())
+        .def_readwrite("active", &SmartKineticOptions::active)
+        .def_readwrite("reltol", &SmartKineticOptions::reltol)
+        .def_readwrite("abstol", &SmartKineticOptions::abstol)
+        .def_readwrite("max_records", &SmartKineticOptions::max_records)
+        ;
+
     py::class_<KineticOptions>(m, "KineticOptions")
         .def(py::init<>())
         .def_readwrite("equilibrium", &KineticOptions::equilibrium)
         .def_readwrite("ode", &KineticOptions::ode)
         .def_readwrite("output", &KineticOptions::output)
+        .def_readwrite("jacobian", &KineticOptions::jacobian)
+        .def_readwrite("batch", &KineticOptions::batch)
+        .def_readwrite("smart", &KineticOptions::smart)
         ;
 }
 
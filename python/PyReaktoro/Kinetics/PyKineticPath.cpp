@@ -41,7 +41,7 @@ void exportKineticPath(py::module& m)
         .def("addPhaseSink", &KineticPath::addPhaseSink)
         .def("addFluidSink", &KineticPath::addFluidSink)
         .def("addSolidSink", &KineticPath::addSolidSink)
-        .def("solve", &KineticPath::solve)
+        .def("solve", &KineticPath::solve, py::call_guard<py::gil_scoped_release>())
         .def("output", &KineticPath::output)
         .def("plot", &KineticPath::plot)
         .def("plots", &KineticPath::plots)
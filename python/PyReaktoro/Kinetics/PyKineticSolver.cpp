@@ -33,18 +33,44 @@ void exportKineticSolver(py::module& m)
     auto step1 = static_cast<double(KineticSolver::*)(ChemicalState&, double)>(&KineticSolver::step);
     auto step2 = static_cast<double(KineticSolver::*)(ChemicalState&, double, double)>(&KineticSolver::step);
 
+    auto solve1 = static_cast<void(KineticSolver::*)(ChemicalState&, double, double)>(&KineticSolver::solve);
+
+    auto addPhaseSink1 = static_cast<void(KineticSolver::*)(std::string, double, std::string)>(&KineticSolver::addPhaseSink);
+    auto addPhaseSink2 = static_cast<void(KineticSolver::*)(Index, double, std::string)>(&KineticSolver::addPhaseSink);
+
+    // The chemical states in the list are copied, advanced without the GIL, and then assigned back to the Python objects
+    auto solve2 = [](KineticSolver& self, py::list states, double t, double dt)
+    {
+        std::vector<ChemicalState> copies;
+        copies.reserve(states.size());
+        for(auto item : states)
+            copies.push_back(item.cast<ChemicalState>());
+        Index num_integrated = 0;
+        {
+            py::gil_scoped_release release;
+            num_integrated = self.solve(copies, t, dt);
+        }
+        for(Index i = 0; i < copies.size(); ++i)
+            states[i].cast<ChemicalState&>() = copies[i];
+        return num_integrated;
+    };
+
     py::class_<KineticSolver>(m, "KineticSolver")
         .def(py::init<const ReactionSystem&>())
         .def("setOptions", &KineticSolver::setOptions)
+        .def("options", &KineticSolver::options, py::return_value_policy::reference_internal)
         .def("setPartition", &KineticSolver::setPartition)
         .def("addSource", &KineticSolver::addSource)
-        .def("addPhaseSink", &KineticSolver::addPhaseSink)
+        .def("addPhaseSink", addPhaseSink1)
+        .def("addPhaseSink", addPhaseSink2)
         .def("addFluidSink", &KineticSolver::addFluidSink)
         .def("addSolidSink", &KineticSolver::addSolidSink)
         .def("initialize", &KineticSolver::initialize)
-        .def("step", step1)
-        .def("step", step2)
-        .def("solve", &KineticSolver::solve)
+        .def("step", step1, py::call_guard<py::gil_scoped_release>())
+        .def("step", step2, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve1, py::call_guard<py::gil_scoped_release>())
+        .def("solve", solve2)
+        .def("numThreads", &KineticSolver::numThreads)
         ;
 }
 
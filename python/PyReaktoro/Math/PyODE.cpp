@@ -30,6 +30,7 @@ void exportODE(py::module& m)
     py::enum_<ODEStepMode>(m, "ODEStepMode")
         .value("Adams", ODEStepMode::Adams)
         .value("BDF", ODEStepMode::BDF)
+        .value("Rosenbrock", ODEStepMode::Rosenbrock)
         ;
 
     py::enum_<ODEIterationMode>(m, "ODEIterationMode")
@@ -52,6 +53,7 @@ void exportODE(py::module& m)
         .def_readwrite("max_num_steps", &ODEOptions::max_num_steps)
         .def_readwrite("max_hnil_warnings", &ODEOptions::max_hnil_warnings)
         .def_readwrite("max_num_error_test_failures", &ODEOptions::max_num_error_test_failures)
+        .def_readwrite("max_jacobian_age", &ODEOptions::max_jacobian_age)
         .def_readwrite("max_num_nonlinear_iterations", &ODEOptions::max_num_nonlinear_iterations)
         .def_readwrite("max_num_convergence_failures", &ODEOptions::max_num_convergence_failures)
         .def_readwrite("nonlinear_convergence_coefficient", &ODEOptions::nonlinear_convergence_coefficient)
@@ -105,6 +105,13 @@ PYBIND11_MODULE(PyReaktoro, m)
 
     // Transport module
     exportChemicalField(m);
+    exportChemicalStateField(m);
     exportMesh(m);
+    exportStructuredMesh(m);
     exportTransportSolver(m);
-    exportReactiveTransportSolver(m);}
+    exportStructuredTransportSolver(m);
+    exportReactiveTransportSolver(m);
+
+    // Util module
+    exportChemicalScalarField(m);
+    exportChemicalSolver(m);}
@@ -107,8 +107,15 @@ void exportWater(py::module& m);
 
 // Transport module
 void exportChemicalField(py::module& m);
+void exportChemicalStateField(py::module& m);
 void exportMesh(py::module& m);
+void exportStructuredMesh(py::module& m);
 void exportTransportSolver(py::module& m);
+void exportStructuredTransportSolver(py::module& m);
 void exportReactiveTransportSolver(py::module& m);
 
+// Util module
+void exportChemicalScalarField(py::module& m);
+void exportChemicalSolver(py::module& m);
+
 } // namespace Reaktoro
@@ -43,6 +43,7 @@ void exportDatabase(py::module& m)
     py::class_<Database>(m, "Database")
         .def(py::init<>())
         .def(py::init<std::string>())
+        .def("save", &Database::save)
         .def("elements", &Database::elements)
         .def("aqueousSpecies", aqueousSpecies1)
         .def("aqueousSpecies", aqueousSpecies2, py::return_value_policy::reference_internal)
@@ -23,6 +23,8 @@ namespace py = pybind11;
 #include <Reaktoro/Common/ThermoScalar.hpp>
 #include <Reaktoro/Thermodynamics/Core/Database.hpp>
 #include <Reaktoro/Thermodynamics/Core/Thermo.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoState.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoStateTable.hpp>
 
 namespace Reaktoro {
 
@@ -50,6 +52,9 @@ void exportThermo(py::module& m)
         .def("standardPartialMolarHeatCapacityConstV", &Thermo::standardPartialMolarHeatCapacityConstV)
         .def("lnEquilibriumConstant", &Thermo::lnEquilibriumConstant)
         .def("logEquilibriumConstant", &Thermo::logEquilibriumConstant)
+        .def("waterThermoStateHGK", &Thermo::waterThermoStateHGK)
+        .def("waterThermoStateWagnerPruss", &Thermo::waterThermoStateWagnerPruss)
+        .def("setWaterThermoStateTable", &Thermo::setWaterThermoStateTable)
         ;
 }
 
@@ -17,6 +17,8 @@
 
 // pybind11 includes
 #include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
+#include <pybind11/stl.h>
 namespace py = pybind11;
 
 // Reaktoro includes
@@ -28,6 +30,7 @@ namespace py = pybind11;
 #include <Reaktoro/Thermodynamics/Water/WaterHelmholtzStateHGK.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterHelmholtzStateWagnerPruss.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoState.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterThermoStateTable.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterThermoStateUtils.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterUtils.hpp>
 
@@ -74,6 +77,18 @@ void exportWaterThermoState(py::module& m)
     m.def("waterThermoStateHGK", waterThermoStateHGK);
     m.def("waterThermoStateWagnerPruss", waterThermoStateWagnerPruss);
     m.def("waterThermoState", waterThermoState);
+
+    py::class_<WaterThermoStateTable>(m, "WaterThermoStateTable")
+        .def(py::init<>())
+        .def(py::init<const std::vector<double>&, const std::vector<double>&>())
+        .def(py::init<const std::vector<double>&, const std::vector<double>&, const WaterThermoStateTable::Function&>())
+        .def("temperatures", &WaterThermoStateTable::temperatures, py::return_value_policy::reference_internal)
+        .def("pressures", &WaterThermoStateTable::pressures, py::return_value_policy::reference_internal)
+        .def("contains", &WaterThermoStateTable::contains)
+        .def("empty", &WaterThermoStateTable::empty)
+        .def("density", &WaterThermoStateTable::density)
+        .def("__call__", &WaterThermoStateTable::operator())
+        ;
 }
 
 void exportWaterHelmholtzState(py::module& m)
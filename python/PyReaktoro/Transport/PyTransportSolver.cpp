@@ -42,6 +42,26 @@ void exportMesh(py::module& m)
         ;
 }
 
+void exportStructuredMesh(py::module& m)
+{
+    py::class_<StructuredMesh>(m, "StructuredMesh")
+        .def(py::init<>())
+        .def(py::init<Index, Index, Index, double, double, double>(), py::arg("nx"), py::arg("ny"), py::arg("nz") = 1, py::arg("lx") = 1.0, py::arg("ly") = 1.0, py::arg("lz") = 1.0)
+        .def("setDiscretization", &StructuredMesh::setDiscretization, py::arg("nx"), py::arg("ny"), py::arg("nz") = 1, py::arg("lx") = 1.0, py::arg("ly") = 1.0, py::arg("lz") = 1.0)
+        .def("numCells", &StructuredMesh::numCells)
+        .def("nx", &StructuredMesh::nx)
+        .def("ny", &StructuredMesh::ny)
+        .def("nz", &StructuredMesh::nz)
+        .def("dx", &StructuredMesh::dx)
+        .def("dy", &StructuredMesh::dy)
+        .def("dz", &StructuredMesh::dz)
+        .def("index", &StructuredMesh::index, py::arg("i"), py::arg("j"), py::arg("k") = 0)
+        .def("numFacesX", &StructuredMesh::numFacesX)
+        .def("numFacesY", &StructuredMesh::numFacesY)
+        .def("numFacesZ", &StructuredMesh::numFacesZ)
+        ;
+}
+
 auto ChemicalField_setitem(ChemicalField& self, Index i, const ChemicalState& state) -> void
 {
     self[i] = state;
@@ -68,10 +88,57 @@ void exportChemicalField(py::module& m)
         ;
 }
 
+void exportChemicalStateField(py::module& m)
+{
+    auto set1 = static_cast<void(ChemicalStateField::*)(const ChemicalState&)>(&ChemicalStateField::set);
+    auto set2 = static_cast<void(ChemicalStateField::*)(Index, const ChemicalState&)>(&ChemicalStateField::set);
+
+    auto temperatures = static_cast<VectorRef(ChemicalStateField::*)()>(&ChemicalStateField::temperatures);
+    auto pressures = static_cast<VectorRef(ChemicalStateField::*)()>(&ChemicalStateField::pressures);
+    auto speciesAmounts = static_cast<MatrixRowMajorRef(ChemicalStateField::*)()>(&ChemicalStateField::speciesAmounts);
+    auto elementDualPotentials = static_cast<MatrixRowMajorRef(ChemicalStateField::*)()>(&ChemicalStateField::elementDualPotentials);
+    auto speciesDualPotentials = static_cast<MatrixRowMajorRef(ChemicalStateField::*)()>(&ChemicalStateField::speciesDualPotentials);
+
+    py::class_<ChemicalStateField>(m, "ChemicalStateField")
+        .def(py::init<Index, const ChemicalSystem&>())
+        .def(py::init<Index, const ChemicalState&>())
+        .def("size", &ChemicalStateField::size)
+        .def("system", &ChemicalStateField::system, py::return_value_policy::reference_internal)
+        .def("set", set1)
+        .def("set", set2)
+        .def("state", &ChemicalStateField::state)
+        .def("temperatures", temperatures, py::return_value_policy::reference_internal)
+        .def("pressures", pressures, py::return_value_policy::reference_internal)
+        .def("speciesAmounts", speciesAmounts, py::return_value_policy::reference_internal)
+        .def("elementDualPotentials", elementDualPotentials, py::return_value_policy::reference_internal)
+        .def("speciesDualPotentials", speciesDualPotentials, py::return_value_policy::reference_internal)
+        .def("elementAmounts", &ChemicalStateField::elementAmounts)
+        ;
+}
+
 void exportTransportSolver(py::module& m)
 {
+    auto data = static_cast<VectorRef(TridiagonalMatrix::*)()>(&TridiagonalMatrix::data);
+    auto row = static_cast<VectorRef(TridiagonalMatrix::*)(Index)>(&TridiagonalMatrix::row);
+    auto solve1 = static_cast<void(TridiagonalMatrix::*)(VectorRef, VectorConstRef) const>(&TridiagonalMatrix::solve);
+    auto solve2 = static_cast<void(TridiagonalMatrix::*)(VectorRef) const>(&TridiagonalMatrix::solve);
+
+    py::class_<TridiagonalMatrix>(m, "TridiagonalMatrix")
+        .def(py::init<>())
+        .def(py::init<Index>())
+        .def("size", &TridiagonalMatrix::size)
+        .def("data", data, py::return_value_policy::reference_internal)
+        .def("row", row, py::return_value_policy::reference_internal)
+        .def("resize", &TridiagonalMatrix::resize)
+        .def("factorize", &TridiagonalMatrix::factorize)
+        .def("solve", solve1)
+        .def("solve", solve2)
+        .def("solveMany", &TridiagonalMatrix::solveMany, py::call_guard<py::gil_scoped_release>())
+        ;
+
     auto step1 = static_cast<void(TransportSolver::*)(VectorRef, VectorConstRef)>(&TransportSolver::step);
     auto step2 = static_cast<void(TransportSolver::*)(VectorRef)>(&TransportSolver::step);
+    auto step3 = static_cast<void(TransportSolver::*)(MatrixRowMajorRef, VectorConstRef)>(&TransportSolver::step);
 
     py::class_<TransportSolver>(m, "TransportSolver")
         .def(py::init<>())
@@ -82,24 +149,63 @@ void exportTransportSolver(py::module& m)
         .def("setTimeStep", &TransportSolver::setTimeStep)
         .def("mesh", &TransportSolver::mesh, py::return_value_policy::reference_internal)
         .def("initialize", &TransportSolver::initialize)
-        .def("step", step1)
-        .def("step", step2)
+        .def("step", step1, py::call_guard<py::gil_scoped_release>())
+        .def("step", step2, py::call_guard<py::gil_scoped_release>())
+        .def("step", step3, py::call_guard<py::gil_scoped_release>())
+        ;
+}
+
+void exportStructuredTransportSolver(py::module& m)
+{
+    py::class_<StructuredTransportSolver>(m, "StructuredTransportSolver")
+        .def(py::init<>())
+        .def("setMesh", &StructuredTransportSolver::setMesh)
+        .def("setFaceVelocities", &StructuredTransportSolver::setFaceVelocities, py::arg("vx"), py::arg("vy"), py::arg("vz") = Vector())
+        .def("setDiffusionCoeff", &StructuredTransportSolver::setDiffusionCoeff)
+        .def("setDiffusionCoeffs", &StructuredTransportSolver::setDiffusionCoeffs)
+        .def("setTimeStep", &StructuredTransportSolver::setTimeStep)
+        .def("setNumThreads", &StructuredTransportSolver::setNumThreads)
+        .def("mesh", &StructuredTransportSolver::mesh, py::return_value_policy::reference_internal)
+        .def("initialize", &StructuredTransportSolver::initialize)
+        .def("step", &StructuredTransportSolver::step, py::call_guard<py::gil_scoped_release>())
         ;
 }
 
 void exportReactiveTransportSolver(py::module& m)
 {
+    py::class_<ReactiveTransportOptions>(m, "ReactiveTransportOptions")
+        .def(py::init<>())
+        .def_readwrite("skip_reltol", &ReactiveTransportOptions::skip_reltol)
+        .def_readwrite("skip_abstol", &ReactiveTransportOptions::skip_abstol)
+        ;
+
+    auto setMesh1 = static_cast<void(ReactiveTransportSolver::*)(const Mesh&)>(&ReactiveTransportSolver::setMesh);
+    auto setMesh2 = static_cast<void(ReactiveTransportSolver::*)(const StructuredMesh&)>(&ReactiveTransportSolver::setMesh);
+
+    auto initialize1 = static_cast<void(ReactiveTransportSolver::*)(const ChemicalField&)>(&ReactiveTransportSolver::initialize);
+    auto initialize2 = static_cast<void(ReactiveTransportSolver::*)(const ChemicalStateField&)>(&ReactiveTransportSolver::initialize);
+
+    auto step1 = static_cast<void(ReactiveTransportSolver::*)(ChemicalField&)>(&ReactiveTransportSolver::step);
+    auto step2 = static_cast<void(ReactiveTransportSolver::*)(ChemicalStateField&)>(&ReactiveTransportSolver::step);
+
     py::class_<ReactiveTransportSolver>(m, "ReactiveTransportSolver")
         .def(py::init<const ChemicalSystem&>())
-        .def("setMesh", &ReactiveTransportSolver::setMesh)
+        .def("setMesh", setMesh1)
+        .def("setMesh", setMesh2)
         .def("setVelocity", &ReactiveTransportSolver::setVelocity)
+        .def("setFaceVelocities", &ReactiveTransportSolver::setFaceVelocities, py::arg("vx"), py::arg("vy"), py::arg("vz") = Vector())
         .def("setDiffusionCoeff", &ReactiveTransportSolver::setDiffusionCoeff)
+        .def("setDiffusionCoeffs", &ReactiveTransportSolver::setDiffusionCoeffs)
         .def("setBoundaryState", &ReactiveTransportSolver::setBoundaryState)
         .def("setTimeStep", &ReactiveTransportSolver::setTimeStep)
+        .def("setOptions", &ReactiveTransportSolver::setOptions)
         .def("system", &ReactiveTransportSolver::system, py::return_value_policy::reference_internal)
+        .def("skippedFraction", &ReactiveTransportSolver::skippedFraction)
         .def("output", &ReactiveTransportSolver::output)
-        .def("initialize", &ReactiveTransportSolver::initialize)
-        .def("step", &ReactiveTransportSolver::step)
+        .def("initialize", initialize1, py::call_guard<py::gil_scoped_release>())
+        .def("initialize", initialize2, py::call_guard<py::gil_scoped_release>())
+        .def("step", step1, py::call_guard<py::gil_scoped_release>())
+        .def("step", step2, py::call_guard<py::gil_scoped_release>())
         ;
 }
 
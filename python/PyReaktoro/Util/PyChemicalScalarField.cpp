@@ -0,0 +1,55 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <sstream>
+
+// pybind11 includes
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/stl.h>
+namespace py = pybind11;
+
+// Reaktoro includes
+#include <Reaktoro/Core/Partition.hpp>
+#include <Reaktoro/Util/ChemicalScalarField.hpp>
+
+namespace Reaktoro {
+
+void exportChemicalScalarField(py::module& m)
+{
+    auto val = static_cast<VectorRef(ChemicalScalarField::*)()>(&ChemicalScalarField::val);
+    auto ddT = static_cast<VectorRef(ChemicalScalarField::*)()>(&ChemicalScalarField::ddT);
+    auto ddP = static_cast<VectorRef(ChemicalScalarField::*)()>(&ChemicalScalarField::ddP);
+    auto ddbe = static_cast<std::vector<Vector>&(ChemicalScalarField::*)()>(&ChemicalScalarField::ddbe);
+    auto ddnk = static_cast<std::vector<Vector>&(ChemicalScalarField::*)()>(&ChemicalScalarField::ddnk);
+
+    py::class_<ChemicalScalarField>(m, "ChemicalScalarField")
+        .def(py::init<>())
+        .def(py::init<const Partition&, Index>())
+        .def("partition", &ChemicalScalarField::partition, py::return_value_policy::reference_internal)
+        .def("size", &ChemicalScalarField::size)
+        .def("val", val, py::return_value_policy::reference_internal)
+        .def("ddT", ddT, py::return_value_policy::reference_internal)
+        .def("ddP", ddP, py::return_value_policy::reference_internal)
+        .def("ddbe", ddbe, py::return_value_policy::reference_internal)
+        .def("ddnk", ddnk, py::return_value_policy::reference_internal)
+        .def("__repr__", [](const ChemicalScalarField& self) { std::stringstream ss; ss << self; return ss.str(); })
+        ;
+}
+
+} // namespace Reaktoro
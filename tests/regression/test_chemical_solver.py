@@ -0,0 +1,93 @@
+import numpy as np
+import pytest
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalSolver,
+    ChemicalSystem,
+    Database,
+    equilibrate,
+    EquilibriumProblem,
+    Partition,
+    ReactionSystem,
+)
+
+
+@pytest.fixture(scope="module")
+def chemical_solver_problem_with_calcite():
+    """
+    Build the chemical states of many field points with different amounts of
+    HCl and CO2 in 1 kg of H2O, which have calcite as a kinetic reaction
+    """
+    database = Database("supcrt98.xml")
+
+    # The aqueous species are listed explicitly so that no redox species with
+    # negligible amounts make the equilibrium sensitivities ill-conditioned
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhase([
+        "H2O(l)", "H+", "OH-", "Ca++", "CaCO3(aq)", "CaOH+", "CO2(aq)",
+        "CO3--", "HCO3-", "Cl-", "HCl(aq)", "CaCl+", "CaCl2(aq)",
+    ])
+    editor.addMineralPhase("Calcite")
+
+    calcite_reaction = editor.addMineralReaction("Calcite")
+    calcite_reaction.setEquation("Calcite = Ca++ + CO3--")
+    calcite_reaction.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    calcite_reaction.addMechanism(
+        "logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0"
+    )
+    calcite_reaction.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    states = []
+    for k in range(12):
+        problem = EquilibriumProblem(system)
+        problem.setPartition(partition)
+        problem.add("H2O", 1, "kg")
+        problem.add("HCl", 0.1 + k, "mmol")
+        problem.add("CO2", 0.1 * k, "mmol")
+        state = equilibrate(problem)
+        state.setSpeciesMass("Calcite", 100, "g")
+        states.append(state)
+
+    return (reactions, partition, states)
+
+
+def test_chemical_solver_react_num_threads(chemical_solver_problem_with_calcite):
+    """
+    A test that checks that reacting the chemical states of many field points
+    produces the same chemical fields and derivatives with one thread and
+    with many threads
+    """
+    reactions, partition, states = chemical_solver_problem_with_calcite
+
+    def fields(num_threads):
+        solver = ChemicalSolver(reactions, len(states))
+        solver.setPartition(partition)
+        solver.setNumThreads(num_threads)
+        solver.setStates(states)
+        solver.react(0.0, 60.0)
+        solver.react(60.0, 60.0)
+
+        result = [solver.porosity(), solver.fluidTotalVolume(), solver.solidTotalVolume()]
+        result += solver.fluidSaturations()
+        result += solver.fluidDensities()
+        result += solver.fluidVolumes()
+        result += solver.componentRates()
+        result += solver.equilibriumSpeciesAmounts()
+
+        return [
+            np.vstack([f.val(), f.ddT(), f.ddP()] + list(f.ddbe()) + list(f.ddnk()))
+            for f in result
+        ]
+
+    expected = fields(1)
+    actual = fields(4)
+
+    for f1, f2 in zip(expected, actual):
+        assert np.allclose(f2, f1, rtol=1e-6, atol=1e-12)
@@ -0,0 +1,29 @@
+from reaktoro import Database
+
+
+def test_database_snapshot(tmpdir):
+    """
+    A test that checks that a database initialized from a binary snapshot of
+    a built-in database has the same elements and species with the same data
+    """
+    database = Database("supcrt98.xml")
+
+    filename = str(tmpdir.join("supcrt98.bin"))
+    database.save(filename)
+
+    snapshot = Database(filename)
+
+    def names(items):
+        return [item.name() for item in items]
+
+    assert names(snapshot.elements()) == names(database.elements())
+    assert names(snapshot.aqueousSpecies()) == names(database.aqueousSpecies())
+    assert names(snapshot.gaseousSpecies()) == names(database.gaseousSpecies())
+    assert names(snapshot.mineralSpecies()) == names(database.mineralSpecies())
+
+    for species in database.aqueousSpecies():
+        other = snapshot.aqueousSpecies(species.name())
+        assert other.formula() == species.formula()
+        assert other.charge() == species.charge()
+        assert other.molarMass() == species.molarMass()
+        assert other.dissociation() == species.dissociation()
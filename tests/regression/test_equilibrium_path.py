@@ -4,11 +4,14 @@ import pytest
 
 from reaktoro import (
     ChemicalEditor,
+    ChemicalQuantity,
     ChemicalSystem,
     Database,
     equilibrate,
     EquilibriumPath,
+    EquilibriumPathOptions,
     EquilibriumProblem,
+    EquilibriumSolver,
 )
 
 
@@ -59,3 +62,71 @@ def test_equilibrium_path(table_regression, tmpdir):
     )
 
     table_regression.check(pathTable)
+
+
+def test_equilibrium_path_continuation(tmpdir):
+    """
+    An integration test that checks that the states calculated along an
+    equilibrium path with the continuation method are the equilibrium
+    states calculated directly at the same points of the path
+    """
+
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhase("H O C Na Cl")
+
+    system = ChemicalSystem(editor)
+
+    problem1 = EquilibriumProblem(system)
+    problem1.add("H2O", 1, "kg")
+    problem1.add("CO2", 0.5, "mol")
+    problem1.add("HCl", 1, "mol")
+
+    problem2 = EquilibriumProblem(system)
+    problem2.add("H2O", 1, "kg")
+    problem2.add("CO2", 0.5, "mol")
+    problem2.add("NaOH", 2, "mol")
+
+    state1 = equilibrate(problem1)
+    state2 = equilibrate(problem2)
+
+    options = EquilibriumPathOptions()
+    options.continuation.active = True
+
+    path = EquilibriumPath(system)
+    path.setOptions(options)
+
+    output = path.output()
+    output.filename(tmpdir.dirname + "/equilibriumPathContinuation.txt")
+    output.add("t")
+    output.add("pH")
+
+    result = path.solve(state1.clone(), state2)
+
+    pathTable = pd.read_csv(
+        tmpdir.dirname + "/equilibriumPathContinuation.txt",
+        index_col=None,
+        delim_whitespace=True,
+    )
+
+    assert len(pathTable) == result.num_steps + 1
+    assert result.num_inaccurate_steps == 0
+
+    # Calculate the equilibrium states directly at the points of the path
+    b1 = state1.elementAmounts()
+    b2 = state2.elementAmounts()
+
+    solver = EquilibriumSolver(system)
+    state = state1.clone()
+
+    for t, pH in zip(pathTable["t"], pathTable["pH"]):
+        solver.solve(state, state1.temperature(), state1.pressure(), b1 + t * (b2 - b1))
+        assert ChemicalQuantity(state).value("pH") == pytest.approx(pH, abs=1e-4)
+
+    # The step lengths of the continuation method must be positive
+    options.continuation.min_step = 0.0
+    path.setOptions(options)
+
+    with pytest.raises(RuntimeError):
+        path.solve(state1.clone(), state2)
@@ -1,7 +1,14 @@
 import numpy as np
 import pytest
 
-from reaktoro import ChemicalState, equilibrate, EquilibriumSolver
+from concurrent.futures import ThreadPoolExecutor
+from reaktoro import (
+    ChemicalState,
+    equilibrate,
+    EquilibriumOptions,
+    EquilibriumSolver,
+    GibbsHessian,
+)
 
 
 @pytest.mark.parametrize(
@@ -320,3 +327,61 @@ def test_equilibrium_solver_approx_overload_3(setup, state_regression):
     )
 
     state_regression.check(state, default_tol=dict(atol=1e-5, rtol=1e-16))
+
+
+def test_equilibrium_solver_threads(
+    equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar,
+):
+    """
+    A test that checks that equilibrium solvers constructed with clones of a
+    chemical system solve equilibrium problems concurrently in different
+    Python threads, which run while the GIL is released, and produce the same
+    chemical states as solving the problems one after the other
+    """
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar
+
+    state = equilibrate(problem)
+
+    T = state.temperature()
+    P = state.pressure()
+    b = state.elementAmounts()
+
+    def solve(k, system):
+        actual = state.clone()
+        solver = EquilibriumSolver(system)
+        solver.solve(actual, T + 5.0 * k, P, b * (1.0 + 0.1 * k))
+        return actual.speciesAmounts()
+
+    expected = [solve(k, system) for k in range(8)]
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        actual = list(executor.map(lambda k: solve(k, system.clone()), range(8)))
+
+    for n1, n2 in zip(expected, actual):
+        assert np.allclose(n2, n1, rtol=1e-14, atol=0.0)
+
+
+def test_equilibrium_solver_hessian_diagonal_lowrank(
+    equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar,
+):
+    """
+    A test that checks that the equilibrium solver produces the same chemical
+    state with the exact Hessian of the Gibbs energy function represented as a
+    diagonal plus a low-rank matrix and with the exact dense Hessian
+    """
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar
+
+    expected = equilibrate(problem)
+
+    options = EquilibriumOptions()
+    options.hessian = GibbsHessian.ExactDiagonalLowRank
+
+    state = ChemicalState(system)
+    solver = EquilibriumSolver(system)
+    solver.setOptions(options)
+    result = solver.solve(state, problem)
+
+    assert result.optimum.succeeded
+    assert np.allclose(
+        state.speciesAmounts(), expected.speciesAmounts(), rtol=1e-6, atol=1e-10
+    )
@@ -0,0 +1,62 @@
+import json
+
+import numpy as np
+
+from reaktoro import Interpreter
+
+
+def test_interpreter_equilibrium_sweep(tmp_path):
+    """
+    A test that checks that an equilibrium sweep solved with one and with
+    many threads writes one converged row per case, and that each row agrees
+    with the equilibrium state calculated for that case alone
+    """
+    def substances(co2):
+        return [
+            {"substance": "H2O", "quantity": 1.0, "units": "kg"},
+            {"substance": "CO2", "quantity": co2, "units": "mol"},
+            {"substance": "NaCl", "quantity": 1.0, "units": "mol"},
+        ]
+
+    def execute(num_threads):
+        output = str(tmp_path / "sweep{}.csv".format(num_threads))
+        calculations = [
+            {
+                "equilibrium": {
+                    "stateReference": "case",
+                    "temperature": {"value": 60.0, "units": "celsius"},
+                    "pressure": {"value": 100.0, "units": "bar"},
+                    "substances": substances(0.3),
+                }
+            },
+            {
+                "equilibriumSweep": {
+                    "temperature": {"value": 25.0, "units": "celsius"},
+                    "pressure": {"value": 100.0, "units": "bar"},
+                    "substances": substances(0.1),
+                    "parameters": [
+                        {"name": "temperature", "start": 20.0, "stop": 80.0, "num": 4},
+                        {"name": "CO2", "values": [0.1, 0.3]},
+                    ],
+                    "threads": num_threads,
+                    "output": {"file": output},
+                }
+            },
+        ]
+        system = {"database": "supcrt98.xml", "elements": ["H", "O", "C", "Na", "Cl"]}
+
+        interpreter = Interpreter()
+        interpreter.executeJsonString(json.dumps({"system": system, "calculations": calculations}))
+
+        return interpreter.state("case").speciesAmounts(), np.loadtxt(output, delimiter=",", skiprows=1)
+
+    for num_threads in [1, 4]:
+        n, rows = execute(num_threads)
+
+        # The temperatures vary slowest and the amounts of CO2 fastest
+        assert rows.shape == (8, 7 + len(n))
+        assert np.allclose(rows[:, 0], [20.0, 20.0, 40.0, 40.0, 60.0, 60.0, 80.0, 80.0])
+        assert np.allclose(rows[:, 3], [0.1, 0.3] * 4)
+        assert np.all(rows[:, 5] == 1.0)
+
+        assert np.allclose(rows[5, 7:], n, rtol=1e-5, atol=1e-10)
@@ -3,13 +3,19 @@ import pandas as pd
 import pytest
 
 from collections import namedtuple
+from concurrent.futures import ThreadPoolExecutor
 from reaktoro import (
     ChemicalEditor,
+    ChemicalState,
     ChemicalSystem,
     Database,
     equilibrate,
     EquilibriumProblem,
+    KineticJacobian,
+    KineticOptions,
     KineticPath,
+    KineticSolver,
+    ODEStepMode,
     Partition,
     ReactionSystem,
 )
@@ -330,3 +336,309 @@ def test_kinetic_path_solve_final_state(
     }
 
     state_regression.check(state, tol=tolerances)
+
+
+@pytest.mark.parametrize(
+    "setup, minerals_to_add",
+    [
+        (
+            pytest.lazy_fixture("kinetic_problem_with_h2o_hcl_caco3_mgco3_co2_calcite"),
+            [mineral_to_add("Calcite", 100, "g")],
+        ),
+    ],
+    ids=["kinetic prob-h2o hcl caco3 mgco3 co2 calcite"],
+)
+def test_kinetic_solver_solve_many_states(setup, minerals_to_add):
+    """
+    An integration test that checks that advancing many chemical states
+    at once with KineticSolver produces the same states as advancing
+    each one of them individually
+    @param setup
+        a tuple that has some objects from kineticProblemSetup.py
+        (problem, reactions, partition)
+    """
+    (problem, reactions, partition) = setup
+
+    state = equilibrate(problem)
+
+    for mineral in minerals_to_add:
+        state.setSpeciesMass(mineral.mineral_name, mineral.amount, mineral.unit)
+
+    options = KineticOptions()
+    options.batch.num_threads = 4
+
+    solver = KineticSolver(reactions)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+
+    states = [state.clone() for _ in range(8)]
+    for i, s in enumerate(states):
+        s.setSpeciesMass("Calcite", 10.0 * (i + 1), "g")
+
+    expected = [s.clone() for s in states]
+    for s in expected:
+        solver.solve(s, 0.0, 60.0)
+
+    num_integrated = solver.solve(states, 0.0, 60.0)
+
+    assert num_integrated == len(states)
+
+    # The batch solve evaluates the rates at the start of the step, which equilibrates
+    # each state once more, so results agree up to the equilibrium tolerance, not bitwise
+    for actual, s in zip(states, expected):
+        assert np.allclose(actual.speciesAmounts(), s.speciesAmounts(), rtol=1e-6, atol=1e-14)
+
+
+@pytest.mark.parametrize(
+    "setup, minerals_to_add",
+    [
+        (
+            pytest.lazy_fixture("kinetic_problem_with_h2o_hcl_caco3_mgco3_co2_calcite"),
+            [mineral_to_add("Calcite", 100, "g")],
+        ),
+    ],
+    ids=["kinetic prob-h2o hcl caco3 mgco3 co2 calcite"],
+)
+def test_kinetic_solver_solve_many_states_custom_models(setup, minerals_to_add):
+    """
+    An integration test that checks that advancing many chemical states
+    at once with KineticSolver, for a chemical system constructed with given
+    thermodynamic and chemical models (which cannot be cloned), produces the
+    same states as advancing each one of them individually
+    @param setup
+        a tuple that has some objects from kineticProblemSetup.py
+        (problem, reactions, partition)
+    """
+    (problem, reactions, partition) = setup
+
+    native = problem.system()
+    system = ChemicalSystem(native.phases(), native.thermoModel(), native.chemicalModel())
+
+    assert native.cloneable()
+    assert not system.cloneable()
+
+    reactions = ReactionSystem(system, reactions.reactions())
+
+    partition = Partition(system)
+    partition.setKineticPhases(["Calcite"])
+
+    state = equilibrate(problem)
+
+    for mineral in minerals_to_add:
+        state.setSpeciesMass(mineral.mineral_name, mineral.amount, mineral.unit)
+
+    options = KineticOptions()
+    options.batch.num_threads = 4
+
+    solver = KineticSolver(reactions)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+
+    states = [ChemicalState(system) for _ in range(8)]
+    for i, s in enumerate(states):
+        s.setTemperature(state.temperature())
+        s.setPressure(state.pressure())
+        s.setSpeciesAmounts(state.speciesAmounts())
+        s.setSpeciesMass("Calcite", 10.0 * (i + 1), "g")
+
+    expected = [s.clone() for s in states]
+    for s in expected:
+        solver.solve(s, 0.0, 60.0)
+
+    num_integrated = solver.solve(states, 0.0, 60.0)
+
+    assert num_integrated == len(states)
+
+    # The batch solve evaluates the rates at the start of the step, which equilibrates
+    # each state once more, so results agree up to the equilibrium tolerance, not bitwise
+    for actual, s in zip(states, expected):
+        assert np.allclose(actual.speciesAmounts(), s.speciesAmounts(), rtol=1e-6, atol=1e-14)
+
+
+@pytest.mark.parametrize("coloring", [True, False], ids=["colored", "uncolored"])
+def test_kinetic_solver_finite_difference_jacobian(
+    kinetic_problem_with_h2o_nacl_caco3_mgco3_hcl_co2_calcite_magnesite_dolomite_halite,
+    coloring,
+):
+    """
+    An integration test that checks that advancing a chemical state with
+    the finite difference Jacobian, with and without perturbing independent
+    columns together, produces the same state as with the Jacobian calculated
+    from the sensitivity of the equilibrium state
+    @param coloring
+        if the independent Jacobian columns are perturbed together
+    """
+    (problem, reactions, partition) = (
+        kinetic_problem_with_h2o_nacl_caco3_mgco3_hcl_co2_calcite_magnesite_dolomite_halite
+    )
+
+    state = equilibrate(problem)
+    state.setSpeciesMass("Calcite", 100, "g")
+    state.setSpeciesMass("Dolomite", 50, "g")
+
+    def solve(mode):
+        options = KineticOptions()
+        options.ode.reltol = 1e-8
+        options.ode.abstol = 1e-12
+        options.jacobian.mode = mode
+        options.jacobian.coloring = coloring
+
+        solver = KineticSolver(reactions)
+        solver.setOptions(options)
+        solver.setPartition(partition)
+
+        result = state.clone()
+        solver.solve(result, 0.0, 3600.0)
+        return result.speciesAmounts()
+
+    expected = solve(KineticJacobian.Sensitivity)
+    actual = solve(KineticJacobian.FiniteDifference)
+
+    assert np.allclose(actual, expected, rtol=1e-6, atol=1e-10)
+
+
+@pytest.mark.parametrize(
+    "setup, minerals_to_add",
+    [
+        (
+            pytest.lazy_fixture("kinetic_problem_with_h2o_hcl_caco3_mgco3_co2_calcite"),
+            [mineral_to_add("Calcite", 100, "g")],
+        ),
+    ],
+    ids=["kinetic prob-h2o hcl caco3 mgco3 co2 calcite"],
+)
+def test_kinetic_solver_smart_rates(setup, minerals_to_add):
+    """
+    An integration test that checks that advancing a chemical state with
+    the smart evaluation of kinetic rates produces the same state as with
+    the exact evaluation of the rates, up to the smart tolerances
+    @param setup
+        a tuple that has some objects from kineticProblemSetup.py
+        (problem, reactions, partition)
+    """
+    (problem, reactions, partition) = setup
+
+    state = equilibrate(problem)
+
+    for mineral in minerals_to_add:
+        state.setSpeciesMass(mineral.mineral_name, mineral.amount, mineral.unit)
+
+    def solve(smart):
+        options = KineticOptions()
+        options.smart.active = smart
+        options.smart.reltol = 1e-2
+
+        solver = KineticSolver(reactions)
+        solver.setOptions(options)
+        solver.setPartition(partition)
+
+        result = state.clone()
+        solver.solve(result, 0.0, 600.0)
+        return result.speciesAmounts()
+
+    expected = solve(False)
+    actual = solve(True)
+
+    assert np.allclose(actual, expected, rtol=1e-3, atol=1e-8)
+
+
+@pytest.mark.parametrize(
+    "setup, minerals_to_add",
+    [
+        (
+            pytest.lazy_fixture("kinetic_problem_with_h2o_hcl_caco3_mgco3_co2_calcite"),
+            [mineral_to_add("Calcite", 100, "g")],
+        ),
+    ],
+    ids=["kinetic prob-h2o hcl caco3 mgco3 co2 calcite"],
+)
+def test_kinetic_solver_rosenbrock(setup, minerals_to_add):
+    """
+    An integration test that checks that advancing a chemical state with
+    the native Rosenbrock method produces the same state as with the BDF
+    method of CVODE, and that the Rosenbrock solver can be reused
+    @param setup
+        a tuple that has some objects from kineticProblemSetup.py
+        (problem, reactions, partition)
+    """
+    (problem, reactions, partition) = setup
+
+    state = equilibrate(problem)
+
+    for mineral in minerals_to_add:
+        state.setSpeciesMass(mineral.mineral_name, mineral.amount, mineral.unit)
+
+    def solver(step):
+        options = KineticOptions()
+        options.ode.step = step
+        options.ode.reltol = 1e-6
+        options.ode.abstol = 1e-12
+        options.ode.max_num_steps = 10000
+
+        solver = KineticSolver(reactions)
+        solver.setOptions(options)
+        solver.setPartition(partition)
+        return solver
+
+    expected = state.clone()
+    solver(ODEStepMode.BDF).solve(expected, 0.0, 600.0)
+
+    rosenbrock = solver(ODEStepMode.Rosenbrock)
+
+    # Solve twice with the same solver, so that the second solve starts from
+    # the Jacobian and step size of the first one
+    for _ in range(2):
+        actual = state.clone()
+        rosenbrock.solve(actual, 0.0, 600.0)
+
+        assert np.allclose(
+            actual.speciesAmounts(), expected.speciesAmounts(), rtol=1e-4, atol=1e-7
+        )
+
+
+@pytest.mark.parametrize(
+    "setup, minerals_to_add",
+    [
+        (
+            pytest.lazy_fixture("kinetic_problem_with_h2o_hcl_caco3_mgco3_co2_calcite"),
+            [mineral_to_add("Calcite", 100, "g")],
+        ),
+    ],
+    ids=["kinetic prob-h2o hcl caco3 mgco3 co2 calcite"],
+)
+def test_kinetic_solver_threads(setup, minerals_to_add):
+    """
+    An integration test that checks that kinetic solvers constructed with
+    reaction systems of different clones of a chemical system advance
+    chemical states concurrently in different Python threads, and produce
+    the same states as advancing them one after the other
+    @param setup
+        a tuple that has some objects from kineticProblemSetup.py
+        (problem, reactions, partition)
+    """
+    (problem, reactions, partition) = setup
+
+    state = equilibrate(problem)
+
+    for mineral in minerals_to_add:
+        state.setSpeciesMass(mineral.mineral_name, mineral.amount, mineral.unit)
+
+    def advance(k, reactions):
+        actual = state.clone()
+        actual.setSpeciesMass("Calcite", 10.0 * (k + 1), "g")
+        solver = KineticSolver(reactions)
+        solver.setPartition(partition)
+        solver.solve(actual, 0.0, 60.0)
+        return actual.speciesAmounts()
+
+    def advance_with_clone(k):
+        clone = ReactionSystem(reactions.system().clone(), reactions.reactions())
+        return advance(k, clone)
+
+    expected = [advance(k, reactions) for k in range(8)]
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        actual = list(executor.map(advance_with_clone, range(8)))
+
+    for n1, n2 in zip(expected, actual):
+        assert np.allclose(n2, n1, rtol=1e-14, atol=0.0)
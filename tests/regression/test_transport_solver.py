@@ -0,0 +1,363 @@
+import numpy as np
+import pytest
+
+from collections import namedtuple
+from concurrent.futures import ThreadPoolExecutor
+
+from reaktoro import (
+    ChemicalEditor,
+    ChemicalField,
+    ChemicalStateField,
+    ChemicalSystem,
+    equilibrate,
+    EquilibriumProblem,
+    EquilibriumSolver,
+    Mesh,
+    ReactiveTransportOptions,
+    ReactiveTransportSolver,
+    StructuredMesh,
+    StructuredTransportSolver,
+    TransportSolver,
+    TridiagonalMatrix,
+)
+
+
+def test_tridiagonal_matrix_solve_many():
+    """
+    A test that checks that solving a tridiagonal system for many
+    right-hand sides at once produces the same solutions as solving
+    it for each right-hand side individually
+    """
+    num_rows, num_cols = 20, 4
+
+    A = TridiagonalMatrix(num_rows)
+    for i in range(num_rows):
+        A.row(i)[:] = [-1.0 - 0.1 * i, 4.0 + 0.01 * i, -1.5]
+    A.factorize()
+
+    rng = np.random.RandomState(0)
+    B = rng.rand(num_rows, num_cols)
+
+    X = B.copy()
+    A.solveMany(X)
+
+    for j in range(num_cols):
+        x = B[:, j].copy()
+        A.solve(x)
+        assert np.allclose(X[:, j], x, rtol=0.0, atol=1e-14)
+
+
+def test_transport_solver_step_many():
+    """
+    A test that checks that transporting many variables at once produces
+    the same results as transporting each variable individually
+    """
+    num_cells, num_vars, num_steps = 20, 4, 10
+
+    transport = TransportSolver()
+    transport.setMesh(Mesh(num_cells, 0.0, 1.0))
+    transport.setVelocity(0.5)
+    transport.setDiffusionCoeff(1e-3)
+    transport.setTimeStep(0.05)
+    transport.initialize()
+
+    rng = np.random.RandomState(0)
+    U0 = rng.rand(num_cells, num_vars)
+    ubc = np.array([1.0, 2.0, 3.0, 4.0])
+
+    U = U0.copy()
+    for _ in range(num_steps):
+        transport.step(U, ubc)
+
+    for j in range(num_vars):
+        u = U0[:, j].copy()
+        transport.setBoundaryValue(ubc[j])
+        for _ in range(num_steps):
+            transport.step(u)
+        assert np.allclose(U[:, j], u, rtol=0.0, atol=1e-14)
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_structured_transport_solver_mass_conservation(num_threads):
+    """
+    A test that checks that advection and diffusion on a structured mesh
+    conserve the total amount of every variable when no flow crosses the
+    boundaries of the domain
+    """
+    nx, ny = 30, 20
+
+    mesh = StructuredMesh(nx, ny, 1, 1.0, 1.0, 1.0)
+
+    # Velocities on the interior faces only, so that the boundaries are closed
+    vx = np.zeros(mesh.numFacesX())
+    vy = np.zeros(mesh.numFacesY())
+    for j in range(ny):
+        for i in range(1, nx):
+            vx[i + (nx + 1) * j] = 0.01 * np.sin(0.3 * i + 0.7 * j)
+    for j in range(1, ny):
+        for i in range(nx):
+            vy[i + nx * j] = 0.01 * np.cos(0.2 * i - 0.5 * j)
+
+    transport = StructuredTransportSolver()
+    transport.setMesh(mesh)
+    transport.setFaceVelocities(vx, vy)
+    transport.setDiffusionCoeff(1e-3)
+    transport.setTimeStep(1.0)
+    transport.setNumThreads(num_threads)
+    transport.initialize()
+
+    rng = np.random.RandomState(0)
+    U = rng.rand(mesh.numCells(), 3)
+    ubc = np.zeros(3)
+
+    totals = U.sum(axis=0)
+
+    for _ in range(50):
+        transport.step(U, ubc)
+
+    assert np.allclose(U.sum(axis=0), totals, rtol=1e-12, atol=0.0)
+
+
+def test_structured_transport_solver_diffusion_2d():
+    """
+    A test that checks that the diffusion on a two-dimensional structured
+    mesh of an initial condition u(x, y) = f(x)*g(y) is the product of the
+    diffusion of f and g on one-dimensional meshes, which holds exactly for
+    the splitting of the diffusion along each direction
+    """
+    nx, ny = 30, 20
+    lx, ly = 1.0, 2.0
+    D, dt, num_steps = 2e-3, 0.5, 20
+
+    def diffuse(mesh, U):
+        transport = StructuredTransportSolver()
+        transport.setMesh(mesh)
+        transport.setDiffusionCoeff(D)
+        transport.setTimeStep(dt)
+        transport.setNumThreads(3)
+        transport.initialize()
+        for _ in range(num_steps):
+            transport.step(U, np.zeros(U.shape[1]))
+        return U
+
+    x = (np.arange(nx) + 0.5) / nx
+    f = np.exp(-((x - 0.3) ** 2) / 0.01)
+    g = np.where(np.arange(ny) < ny // 2, 2.0, 1.0)
+
+    fx = diffuse(StructuredMesh(nx, 1, 1, lx, 1.0, 1.0), f.reshape(-1, 1).copy())[:, 0]
+    gy = diffuse(StructuredMesh(ny, 1, 1, ly, 1.0, 1.0), g.reshape(-1, 1).copy())[:, 0]
+
+    mesh = StructuredMesh(nx, ny, 1, lx, ly, 1.0)
+
+    # The cells are ordered with the x-index running fastest
+    U = np.outer(g, f).reshape(-1, 1).copy()
+    U = diffuse(mesh, U)
+
+    assert not np.allclose(fx, f)
+    assert np.allclose(U[:, 0].reshape(ny, nx), np.outer(gy, fx), rtol=0.0, atol=1e-14)
+
+
+reactive_transport_setup = namedtuple("reactive_transport_setup", ["system", "state_ic", "state_bc"])
+
+
+@pytest.fixture(scope="module")
+def reactive_transport_problem_calcite_brine():
+    """
+    Build the initial and boundary chemical states of a reactive transport
+    problem in which a brine with CO2 and Mg++ is injected in a rock with
+    quartz and calcite
+    """
+    editor = ChemicalEditor()
+    editor.addAqueousPhase("H2O NaCl CaCO3 MgCO3 CO2")
+    editor.addMineralPhase("Quartz")
+    editor.addMineralPhase("Calcite")
+    editor.addMineralPhase("Dolomite")
+
+    system = ChemicalSystem(editor)
+
+    problem_ic = EquilibriumProblem(system)
+    problem_ic.setTemperature(60.0, "celsius")
+    problem_ic.setPressure(100.0, "bar")
+    problem_ic.add("H2O", 1.0, "kg")
+    problem_ic.add("NaCl", 0.7, "mol")
+    problem_ic.add("CaCO3", 10, "mol")
+    problem_ic.add("SiO2", 10, "mol")
+
+    problem_bc = EquilibriumProblem(system)
+    problem_bc.setTemperature(60.0, "celsius")
+    problem_bc.setPressure(100.0, "bar")
+    problem_bc.add("H2O", 1.0, "kg")
+    problem_bc.add("NaCl", 0.90, "mol")
+    problem_bc.add("MgCl2", 0.05, "mol")
+    problem_bc.add("CaCl2", 0.01, "mol")
+    problem_bc.add("CO2", 0.75, "mol")
+
+    state_ic = equilibrate(problem_ic)
+    state_bc = equilibrate(problem_bc)
+
+    state_ic.scalePhaseVolume("Aqueous", 0.1, "m3")
+    state_ic.scalePhaseVolume("Quartz", 0.88, "m3")
+    state_ic.scalePhaseVolume("Calcite", 0.02, "m3")
+
+    return reactive_transport_setup(system, state_ic, state_bc)
+
+
+def reactive_transport_solver(setup, num_cells, options):
+    """
+    Create a reactive transport solver on a one-dimensional mesh for a
+    reactive transport problem
+    """
+    day = 86400.0
+
+    rt = ReactiveTransportSolver(setup.system)
+    rt.setMesh(Mesh(num_cells, 0.0, float(num_cells)))
+    rt.setVelocity(1.0 / day)
+    rt.setDiffusionCoeff(1.0e-9)
+    rt.setBoundaryState(setup.state_bc)
+    rt.setTimeStep(0.5 * day)
+    rt.setOptions(options)
+    return rt
+
+
+def test_reactive_transport_solver_skip_equilibrium(reactive_transport_problem_calcite_brine):
+    """
+    A test that checks that skipping the equilibrium calculations of cells
+    whose amounts of elements barely changed produces the same total amounts
+    of elements as equilibrating all cells, up to the skip tolerances
+    """
+    setup = reactive_transport_problem_calcite_brine
+    num_cells, num_steps = 20, 40
+
+    def element_totals(options):
+        rt = reactive_transport_solver(setup, num_cells, options)
+        field = ChemicalField(num_cells, setup.state_ic)
+        rt.initialize(field)
+        skipped = 0.0
+        for _ in range(num_steps):
+            rt.step(field)
+            skipped += rt.skippedFraction()
+        totals = sum(field[i].elementAmounts() for i in range(num_cells))
+        return totals, skipped
+
+    expected, skipped = element_totals(ReactiveTransportOptions())
+
+    assert skipped == 0.0
+
+    options = ReactiveTransportOptions()
+    options.skip_reltol = 1e-3
+    options.skip_abstol = 1e-6
+
+    actual, skipped = element_totals(options)
+
+    assert skipped > 0.0
+    assert np.allclose(actual, expected, rtol=options.skip_reltol, atol=options.skip_abstol)
+
+
+def test_reactive_transport_solver_chemical_state_field(reactive_transport_problem_calcite_brine):
+    """
+    A test that checks that stepping a field of chemical states stored in
+    contiguous arrays produces the same chemical states as stepping a field
+    of individual chemical states
+    """
+    setup = reactive_transport_problem_calcite_brine
+    num_cells, num_steps = 20, 40
+
+    rt1 = reactive_transport_solver(setup, num_cells, ReactiveTransportOptions())
+    rt2 = reactive_transport_solver(setup, num_cells, ReactiveTransportOptions())
+
+    field1 = ChemicalField(num_cells, setup.state_ic)
+    field2 = ChemicalStateField(num_cells, setup.state_ic)
+
+    rt1.initialize(field1)
+    rt2.initialize(field2)
+
+    for _ in range(num_steps):
+        rt1.step(field1)
+        rt2.step(field2)
+
+    for i in range(num_cells):
+        assert np.allclose(
+            field2.state(i).speciesAmounts(),
+            field1[i].speciesAmounts(),
+            rtol=1e-10,
+            atol=1e-20,
+        )
+
+    # The number of chemical states in the field must match the mesh
+    with pytest.raises(RuntimeError):
+        rt1.initialize(ChemicalField(num_cells + 1, setup.state_ic))
+
+
+def test_chemical_state_field_equilibrium_solve(reactive_transport_problem_calcite_brine):
+    """
+    A test that checks that the arrays of a field of chemical states are
+    views of its data and that solving the equilibrium problems of all its
+    chemical states at once produces the same chemical states as solving
+    them one by one
+    """
+    setup = reactive_transport_problem_calcite_brine
+    num_cells = 10
+
+    field = ChemicalStateField(num_cells, setup.state_ic)
+
+    # Changing the arrays returned by the field changes its chemical states
+    field.temperatures()[3] += 1.0
+    assert field.state(3).temperature() == setup.state_ic.temperature() + 1.0
+    field.temperatures()[3] -= 1.0
+
+    b = field.elementAmounts()
+    assert np.allclose(b[0], setup.state_ic.elementAmounts(), rtol=1e-14, atol=0.0)
+
+    b_bc = setup.state_bc.elementAmounts()
+    for i in range(num_cells):
+        b[i] += 0.01 * i * b_bc
+
+    solver = EquilibriumSolver(setup.system)
+    results = solver.solve(field, b)
+
+    assert len(results) == num_cells
+    assert all(result.optimum.succeeded for result in results)
+    assert np.allclose(field.elementAmounts(), b, rtol=1e-8, atol=1e-14)
+
+    for i in range(num_cells):
+        state = setup.state_ic.clone()
+        EquilibriumSolver(setup.system).solve(state, state.temperature(), state.pressure(), b[i])
+        assert np.allclose(
+            field.speciesAmounts()[i],
+            state.speciesAmounts(),
+            rtol=1e-10,
+            atol=1e-20,
+        )
+
+    # The amounts of elements must have one row per chemical state
+    with pytest.raises(RuntimeError):
+        solver.solve(field, b[:-1])
+
+
+def test_reactive_transport_solver_threads(reactive_transport_problem_calcite_brine):
+    """
+    A test that checks that reactive transport solvers constructed with
+    clones of a chemical system step fields of chemical states concurrently
+    in different Python threads, and produce the same chemical states as
+    stepping them one after the other
+    """
+    setup = reactive_transport_problem_calcite_brine
+    num_cells, num_steps = 20, 20
+
+    def run(k, system):
+        rt = reactive_transport_solver(setup._replace(system=system), num_cells, ReactiveTransportOptions())
+        rt.setVelocity((1.0 - 0.2 * k) / 86400.0)
+        field = ChemicalStateField(num_cells, system)
+        field.set(setup.state_ic)
+        rt.initialize(field)
+        for _ in range(num_steps):
+            rt.step(field)
+        return field.speciesAmounts().copy()
+
+    expected = [run(k, setup.system) for k in range(4)]
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        actual = list(executor.map(lambda k: run(k, setup.system.clone()), range(4)))
+
+    for n1, n2 in zip(expected, actual):
+        assert np.allclose(n2, n1, rtol=1e-14, atol=0.0)
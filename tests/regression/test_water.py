@@ -0,0 +1,35 @@
+import numpy as np
+
+from reaktoro import Database, Thermo, WaterThermoStateTable
+
+
+def test_water_thermo_state_table():
+    """
+    A test that checks that the tabulated thermodynamic state of liquid water
+    agrees with the Wagner and Pruss (1995) equation of state within the error
+    bound documented for a grid spacing of 5 K and 25 bar, and that a Thermo
+    instance uses the table once it is set
+    """
+    temperatures = list(273.15 + np.arange(0.0, 301.0, 5.0))
+    pressures = [1.0e5] + list(np.arange(25.0, 501.0, 25.0) * 1.0e5)
+
+    table = WaterThermoStateTable(temperatures, pressures)
+
+    thermo = Thermo(Database("supcrt98.xml"))
+
+    for T in np.linspace(300.0, 500.0, 7):
+        for P in np.linspace(50.0e5, 450.0e5, 7):
+            expected = thermo.waterThermoStateWagnerPruss(T, P)
+            actual = table(T, P)
+            assert actual.density.val == table.density(T, P).val
+            assert np.isclose(actual.density.val, expected.density.val, rtol=1e-6)
+            assert np.isclose(actual.density.ddT, expected.density.ddT, atol=3e-4)
+            assert np.isclose(actual.density.ddP, expected.density.ddP, rtol=5e-4)
+
+    # Outside the grid, the Wagner and Pruss (1995) equation of state is evaluated
+    assert not table.contains(600.0, 1.0e8)
+    expected = thermo.waterThermoStateWagnerPruss(600.0, 1.0e8)
+    assert table.density(600.0, 1.0e8).val == expected.density.val
+
+    thermo.setWaterThermoStateTable(table)
+    assert thermo.waterThermoStateWagnerPruss(400.0, 1.0e7).density.val == table.density(400.0, 1.0e7).val
@@ -0,0 +1,38 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+/// Convert a database file (or a built-in database) into a binary snapshot file.
+/// The snapshot file can then be used to initialize a Database instance without parsing xml.
+int main(int argc, char **argv)
+{
+    if(argc != 3)
+    {
+        std::cerr << "Usage: database-snapshot <database> <snapshot>" << std::endl;
+        std::cerr << "Example: database-snapshot supcrt98.xml supcrt98.bin" << std::endl;
+        return 1;
+    }
+
+    Database database(argv[1]);
+    database.save(argv[2]);
+}